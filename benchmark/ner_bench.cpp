@@ -0,0 +1,399 @@
+// ner_bench: measures the stages of ner() (tokenization, batched evaluation, decoding) outside of DuckDB, on
+// synthetic corpora generated from a fixed seed, with 1 to N worker threads each owning an execution context like
+// DuckDB's threads do. Build with -DNER_BUILD_BENCH=ON.
+#include "ner_model.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+struct bench_params {
+	std::string model;
+	std::vector<std::string> corpora = {"short", "medium", "long"};
+	int32_t n_rows = 1000;
+	int32_t max_workers = 0;
+	int32_t ner_threads = 1;
+	int32_t n_repeat = 3;
+	uint32_t seed = 42;
+	bool json = false;
+};
+
+struct bench_corpus_spec {
+	const char *name;
+	int32_t min_words;
+	int32_t max_words;
+};
+
+static const bench_corpus_spec BENCH_CORPORA[] = {{"short", 4, 16}, {"medium", 40, 120}, {"long", 300, 600}};
+
+static const char *BENCH_WORDS[] = {"the",   "of",   "and",     "to",      "in",     "a",      "is",     "was",
+                                    "for",   "on",   "with",    "said",    "year",   "new",    "first",  "city",
+                                    "after", "team", "could",   "between", "report", "market", "during", "people",
+                                    "said",  "in",   "percent", "meeting", "the",    "of",     "company", "government"};
+static const char *BENCH_NAMES[] = {"Angela", "Merkel", "Emmanuel", "Macron",  "Paris",   "Berlin",
+                                    "Tokyo",  "Google", "Toronto",  "DuckDB",  "Labs",    "Microsoft",
+                                    "Union",  "NATO",   "European", "Reuters", "Madrid",  "Amsterdam"};
+
+template <class T, size_t N>
+static size_t bench_count(const T (&)[N]) {
+	return N;
+}
+
+// std::mt19937 produces the same sequence on every platform, unlike the standard distributions, so it is used
+// directly to keep the corpora identical across machines and runs
+static std::vector<std::string> bench_make_corpus(const bench_corpus_spec &spec, int32_t n_rows, uint32_t seed) {
+	std::mt19937 rng(seed);
+	std::vector<std::string> rows(n_rows);
+	for (auto &row : rows) {
+		const int32_t n_words = spec.min_words + (int32_t)(rng() % (uint32_t)(spec.max_words - spec.min_words + 1));
+		for (int32_t w = 0; w < n_words; w++) {
+			if (w > 0) {
+				row += rng() % 12 == 0 ? ". " : " ";
+			}
+			if (rng() % 5 == 0) {
+				row += BENCH_NAMES[rng() % bench_count(BENCH_NAMES)];
+			} else {
+				row += BENCH_WORDS[rng() % bench_count(BENCH_WORDS)];
+			}
+		}
+		row += '.';
+	}
+	return rows;
+}
+
+// Rows of one worker, processed like a DataChunk by the extension
+struct bench_worker {
+	struct ner_exec *exec = nullptr;
+	std::vector<const std::string *> rows;
+
+	std::vector<ner_vocab_id> tokens;
+	std::vector<ner_span> spans;
+	std::vector<size_t> offsets;
+	std::vector<int32_t> counts;
+	std::vector<float> logits;
+	std::vector<ner_entity> entities;
+	int64_t n_tokens = 0;
+	int64_t n_entities = 0;
+
+	std::vector<size_t> order;
+	std::vector<ner_vocab_id> batch_tokens;
+	std::vector<int32_t> batch_counts;
+	std::vector<float> batch_logits;
+};
+
+static void bench_tokenize(struct ner_ctx *ctx, bench_worker &worker) {
+	const int32_t n_max_tokens = ner_n_max_tokens(ctx);
+	const size_t n_rows = worker.rows.size();
+	worker.tokens.resize(n_rows * n_max_tokens);
+	worker.spans.resize(n_rows * n_max_tokens);
+	worker.offsets.resize(n_rows);
+	worker.counts.resize(n_rows);
+	worker.n_tokens = 0;
+	for (size_t r = 0; r < n_rows; r++) {
+		const auto &text = *worker.rows[r];
+		worker.offsets[r] = r * n_max_tokens;
+		ner_tokenize_spans(ctx, text.data(), text.size(), worker.tokens.data() + worker.offsets[r],
+		                   worker.spans.data() + worker.offsets[r], &worker.counts[r], n_max_tokens);
+		worker.n_tokens += worker.counts[r];
+	}
+}
+
+// Sorts the rows by length and packs them into batches of at most NER_BATCH_TOKENS padded tokens, as ner() does
+static void bench_eval(struct ner_ctx *ctx, bench_worker &worker, int32_t ner_threads) {
+	const int32_t n_max_tokens = ner_n_max_tokens(ctx);
+	const int32_t n_batch_tokens = std::max(n_max_tokens, NER_BATCH_TOKENS);
+	const int32_t n_labels = ner_n_labels(ctx);
+	const size_t n_rows = worker.rows.size();
+	worker.logits.resize(n_rows * n_max_tokens * n_labels);
+	worker.batch_tokens.resize(n_batch_tokens);
+	worker.batch_counts.resize(n_batch_tokens);
+	worker.batch_logits.resize((size_t)n_batch_tokens * n_labels);
+
+	worker.order.resize(n_rows);
+	for (size_t r = 0; r < n_rows; r++) {
+		worker.order[r] = r;
+	}
+	std::stable_sort(worker.order.begin(), worker.order.end(),
+	                 [&](size_t a, size_t b) { return worker.counts[a] < worker.counts[b]; });
+
+	for (size_t begin = 0; begin < n_rows;) {
+		size_t end = begin;
+		int32_t n_seq = 0;
+		while (end < n_rows) {
+			const int32_t n_seq_new = std::max(n_seq, worker.counts[worker.order[end]]);
+			if (end > begin && (int64_t)(end - begin + 1) * ner_seq_bucket(ctx, n_seq_new) > n_batch_tokens) {
+				break;
+			}
+			n_seq = n_seq_new;
+			end++;
+		}
+		const int32_t n_batch = (int32_t)(end - begin);
+		for (int32_t b = 0; b < n_batch; b++) {
+			const size_t r = worker.order[begin + b];
+			memcpy(worker.batch_tokens.data() + b * n_seq, worker.tokens.data() + worker.offsets[r],
+			       worker.counts[r] * sizeof(ner_vocab_id));
+			worker.batch_counts[b] = worker.counts[r];
+		}
+		ner_eval_batch(worker.exec, ner_threads, worker.batch_tokens.data(), worker.batch_counts.data(), n_batch, n_seq,
+		               worker.batch_logits.data());
+		for (int32_t b = 0; b < n_batch; b++) {
+			const size_t r = worker.order[begin + b];
+			memcpy(worker.logits.data() + worker.offsets[r] * n_labels,
+			       worker.batch_logits.data() + (size_t)b * n_seq * n_labels,
+			       (size_t)worker.counts[r] * n_labels * sizeof(float));
+		}
+		begin = end;
+	}
+}
+
+static void bench_decode(struct ner_ctx *ctx, bench_worker &worker) {
+	const int32_t n_labels = ner_n_labels(ctx);
+	worker.n_entities = 0;
+	for (size_t r = 0; r < worker.rows.size(); r++) {
+		worker.entities.resize(worker.counts[r]);
+		worker.n_entities += ner_decode(ctx, worker.tokens.data() + worker.offsets[r],
+		                                worker.spans.data() + worker.offsets[r], worker.counts[r],
+		                                worker.logits.data() + worker.offsets[r] * n_labels, worker.entities.data(),
+		                                worker.counts[r]);
+	}
+}
+
+// Runs fn(worker) on every worker in its own thread and returns the wall time in milliseconds
+template <class F>
+static double bench_stage(std::vector<bench_worker> &workers, F fn) {
+	const auto start = std::chrono::steady_clock::now();
+	if (workers.size() == 1) {
+		fn(workers[0]);
+	} else {
+		std::vector<std::thread> threads;
+		for (auto &worker : workers) {
+			threads.emplace_back([&fn, &worker]() { fn(worker); });
+		}
+		for (auto &thread : threads) {
+			thread.join();
+		}
+	}
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Current resident set size of the process in bytes, 0 where /proc/self/statm is not available
+static int64_t bench_rss() {
+	int64_t rss = 0;
+#ifndef _WIN32
+	FILE *f = fopen("/proc/self/statm", "r");
+	if (f) {
+		long long size, resident;
+		if (fscanf(f, "%lld %lld", &size, &resident) == 2) {
+			rss = (int64_t)resident * sysconf(_SC_PAGESIZE);
+		}
+		fclose(f);
+	}
+#endif
+	return rss;
+}
+
+// Peak resident set size of the whole process in bytes, over every configuration run so far
+static int64_t bench_peak_rss() {
+#ifndef _WIN32
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+	return usage.ru_maxrss;
+#else
+	return (int64_t)usage.ru_maxrss * 1024;
+#endif
+#else
+	return 0;
+#endif
+}
+
+struct bench_result {
+	std::string corpus;
+	int32_t n_workers;
+	int64_t n_rows;
+	int64_t n_tokens;
+	int64_t n_entities;
+	// Best time of each stage over the repetitions, in milliseconds
+	double tokenize_ms;
+	double eval_ms;
+	double decode_ms;
+	// Largest resident set size sampled after each stage, while the execution contexts of the workers are alive
+	int64_t rss;
+};
+
+static bench_result bench_run(struct ner_ctx *ctx, const bench_params &params, const std::string &corpus_name,
+                              const std::vector<std::string> &corpus, int32_t n_workers) {
+	std::vector<bench_worker> workers(n_workers);
+	for (size_t r = 0; r < corpus.size(); r++) {
+		workers[r % n_workers].rows.push_back(&corpus[r]);
+	}
+	for (auto &worker : workers) {
+		worker.exec = ner_exec_init(ctx);
+	}
+
+	bench_result result = {corpus_name, n_workers, (int64_t)corpus.size(), 0, 0, 1e300, 1e300, 1e300, 0};
+	for (int32_t i = 0; i < params.n_repeat; i++) {
+		result.tokenize_ms =
+		    std::min(result.tokenize_ms, bench_stage(workers, [&](bench_worker &w) { bench_tokenize(ctx, w); }));
+		result.rss = std::max(result.rss, bench_rss());
+		result.eval_ms = std::min(result.eval_ms,
+		                          bench_stage(workers, [&](bench_worker &w) { bench_eval(ctx, w, params.ner_threads); }));
+		result.rss = std::max(result.rss, bench_rss());
+		result.decode_ms = std::min(result.decode_ms, bench_stage(workers, [&](bench_worker &w) { bench_decode(ctx, w); }));
+		result.rss = std::max(result.rss, bench_rss());
+	}
+	for (auto &worker : workers) {
+		result.n_tokens += worker.n_tokens;
+		result.n_entities += worker.n_entities;
+		ner_exec_free(worker.exec);
+	}
+	return result;
+}
+
+static std::string bench_json_string(const std::string &value) {
+	std::string result = "\"";
+	for (char c : value) {
+		if (c == '"' || c == '\\') {
+			result += '\\';
+		}
+		result += c;
+	}
+	return result + "\"";
+}
+
+static void bench_usage(const char *argv0) {
+	fprintf(stderr,
+	        "usage: %s -m MODEL [options]\n"
+	        "  -m, --model PATH       model file\n"
+	        "  -c, --corpus LIST      corpora among short,medium,long (default: all)\n"
+	        "  -n, --rows N           rows per corpus (default: 1000)\n"
+	        "  -t, --threads N        scale from 1 to N worker threads (default: hardware threads)\n"
+	        "      --ner-threads N    ggml threads per worker, as the ner_threads setting (default: 1)\n"
+	        "  -r, --repeat N         repetitions, the best time is reported (default: 3)\n"
+	        "  -s, --seed N           seed of the corpora (default: 42)\n"
+	        "      --json             machine-readable output\n",
+	        argv0);
+}
+
+static bool bench_parse(int argc, char **argv, bench_params &params) {
+	for (int i = 1; i < argc; i++) {
+		const std::string arg = argv[i];
+		if (arg == "--json") {
+			params.json = true;
+			continue;
+		}
+		if (i + 1 >= argc) {
+			return false;
+		}
+		const char *value = argv[++i];
+		if (arg == "-m" || arg == "--model") {
+			params.model = value;
+		} else if (arg == "-c" || arg == "--corpus") {
+			params.corpora.clear();
+			std::string list = value;
+			for (size_t pos = 0; pos <= list.size();) {
+				size_t comma = std::min(list.find(',', pos), list.size());
+				params.corpora.push_back(list.substr(pos, comma - pos));
+				pos = comma + 1;
+			}
+		} else if (arg == "-n" || arg == "--rows") {
+			params.n_rows = atoi(value);
+		} else if (arg == "-t" || arg == "--threads") {
+			params.max_workers = atoi(value);
+		} else if (arg == "--ner-threads") {
+			params.ner_threads = atoi(value);
+		} else if (arg == "-r" || arg == "--repeat") {
+			params.n_repeat = atoi(value);
+		} else if (arg == "-s" || arg == "--seed") {
+			params.seed = (uint32_t)strtoul(value, nullptr, 10);
+		} else {
+			return false;
+		}
+	}
+	return !params.model.empty() && params.n_rows > 0 && params.ner_threads > 0 && params.n_repeat > 0;
+}
+
+int main(int argc, char **argv) {
+	bench_params params;
+	if (!bench_parse(argc, argv, params)) {
+		bench_usage(argv[0]);
+		return 1;
+	}
+	if (params.max_workers <= 0) {
+		params.max_workers = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	struct ner_ctx *ctx = ner_load_from_file(params.model.c_str());
+	if (!ctx) {
+		fprintf(stderr, "%s: failed to load model '%s'\n", argv[0], params.model.c_str());
+		return 1;
+	}
+
+	// 1, 2, 4, ... worker threads, up to and including max_workers
+	std::vector<int32_t> worker_counts;
+	for (int32_t n = 1; n < params.max_workers; n *= 2) {
+		worker_counts.push_back(n);
+	}
+	worker_counts.push_back(params.max_workers);
+
+	std::vector<bench_result> results;
+	for (const auto &name : params.corpora) {
+		const bench_corpus_spec *spec = nullptr;
+		for (const auto &candidate : BENCH_CORPORA) {
+			spec = name == candidate.name ? &candidate : spec;
+		}
+		if (!spec) {
+			fprintf(stderr, "%s: unknown corpus '%s'\n", argv[0], name.c_str());
+			ner_free(ctx);
+			return 1;
+		}
+		const auto corpus = bench_make_corpus(*spec, params.n_rows, params.seed);
+		for (auto n_workers : worker_counts) {
+			results.push_back(bench_run(ctx, params, name, corpus, n_workers));
+			const auto &r = results.back();
+			if (!params.json) {
+				const double total_ms = r.tokenize_ms + r.eval_ms + r.decode_ms;
+				printf("%-7s workers=%-3d rows=%-6lld tokens=%-8lld tokenize=%9.2fms eval=%10.2fms decode=%8.2fms "
+				       "rows/s=%9.1f tokens/s=%10.1f rss=%.1fMB\n",
+				       r.corpus.c_str(), r.n_workers, (long long)r.n_rows, (long long)r.n_tokens, r.tokenize_ms,
+				       r.eval_ms, r.decode_ms, r.n_rows * 1000.0 / total_ms, r.n_tokens * 1000.0 / total_ms,
+				       r.rss / (1024.0 * 1024.0));
+				fflush(stdout);
+			}
+		}
+	}
+
+	if (params.json) {
+		printf("{\"model\": %s, \"seed\": %u, \"rows\": %d, \"ner_threads\": %d, \"repeat\": %d, \"n_embd\": %d, "
+		       "\"results\": [",
+		       bench_json_string(params.model).c_str(), params.seed, params.n_rows, params.ner_threads, params.n_repeat,
+		       ner_n_embd(ctx));
+		for (size_t i = 0; i < results.size(); i++) {
+			const auto &r = results[i];
+			const double total_ms = r.tokenize_ms + r.eval_ms + r.decode_ms;
+			printf("%s\n  {\"corpus\": \"%s\", \"workers\": %d, \"rows\": %lld, \"tokens\": %lld, \"entities\": %lld, "
+			       "\"tokenize_ms\": %.3f, \"eval_ms\": %.3f, \"decode_ms\": %.3f, \"rows_per_sec\": %.1f, "
+			       "\"tokens_per_sec\": %.1f, \"rss_bytes\": %lld}",
+			       i ? "," : "", r.corpus.c_str(), r.n_workers, (long long)r.n_rows, (long long)r.n_tokens,
+			       (long long)r.n_entities, r.tokenize_ms, r.eval_ms, r.decode_ms, r.n_rows * 1000.0 / total_ms,
+			       r.n_tokens * 1000.0 / total_ms, (long long)r.rss);
+		}
+		printf("\n], \"process_peak_rss_bytes\": %lld}\n", (long long)bench_peak_rss());
+	} else {
+		printf("process peak_rss=%.1fMB\n", bench_peak_rss() / (1024.0 * 1024.0));
+	}
+
+	ner_free(ctx);
+	return 0;
+}
@@ -0,0 +1,89 @@
+import sys
+import time
+import duckdb
+from datasets import load_dataset
+
+# Reports tokens/sec and entity-level F1 of converted models (e.g. one per quantization type, see
+# convert_ner_to_ggml.py) on a fixed evaluation set: the first sentences of the CoNLL-2003 test split.
+# With --prefilter, every model is also run with prefilter := 'auto', reporting the share of sentences it skipped.
+
+if len(sys.argv) < 3:
+    print("Usage: benchmark_quantization.py path/to/ner.duckdb_extension model.bin [model.bin ...] [--sentences N] "
+          "[--prefilter]\n")
+    sys.exit(1)
+
+args = sys.argv[1:]
+n_sentences = 1000
+if "--sentences" in args:
+    i = args.index("--sentences")
+    n_sentences = int(args[i + 1])
+    del args[i:i + 2]
+prefilters = ["none"]
+if "--prefilter" in args:
+    args.remove("--prefilter")
+    prefilters.append("auto")
+extension_path, model_paths = args[0], args[1:]
+
+# Gold entities as (sentence, start, end, label), with character offsets into the words joined by spaces
+dataset = load_dataset("conll2003", split="test")
+tag_names = dataset.features["ner_tags"].feature.names
+texts = []
+gold = set()
+for sentence in dataset.select(range(min(n_sentences, len(dataset)))):
+    row_id = len(texts)
+    offsets = []
+    position = 0
+    for word in sentence["tokens"]:
+        offsets.append((position, position + len(word)))
+        position += len(word) + 1
+    texts.append(" ".join(sentence["tokens"]))
+
+    entity = None
+    for (start, end), tag in zip(offsets, [tag_names[t] for t in sentence["ner_tags"]]):
+        if entity and not (tag.startswith("I-") and tag[2:] == entity[2]):
+            gold.add((row_id, entity[0], entity[1], entity[2]))
+            entity = None
+        if tag.startswith("B-") or (tag.startswith("I-") and not entity):
+            entity = [start, end, tag[2:]]
+        elif entity:
+            entity[1] = end
+    if entity:
+        gold.add((row_id, entity[0], entity[1], entity[2]))
+
+con = duckdb.connect(config={"allow_unsigned_extensions": "true"})
+con.execute(f"LOAD '{extension_path}'")
+con.execute("CREATE TABLE eval(id INTEGER, body VARCHAR)")
+con.executemany("INSERT INTO eval VALUES (?, ?)", list(enumerate(texts)))
+
+print(f"{len(texts)} sentences, {len(gold)} entities")
+print(f"{'model':<60} {'prefilter':>9} {'skipped':>8} {'tokens/s':>10} {'precision':>10} {'recall':>10} {'F1':>8}")
+for model_path in model_paths:
+    # Models load in the background: wait until this one serves queries
+    con.execute(f"SET ner_model_path = '{model_path}'")
+    while True:
+        path, loading, error = con.execute("SELECT path, loading, error FROM ner_model_info()").fetchone()
+        if loading is None:
+            break
+        time.sleep(0.05)
+    if path != model_path:
+        print(f"{model_path}: {error}")
+        continue
+    n_tokens = con.execute("SELECT sum(len(ner_tokenize(body))) FROM eval").fetchone()[0]
+    for prefilter in prefilters:
+        scan = f"ner_scan((SELECT id, body FROM eval), prefilter := '{prefilter}')"
+        # Warm up (model pages, graphs), then time the extraction on its own. Throughput counts the tokens of every
+        # sentence, skipped or not.
+        con.execute(f"SELECT count(*) FROM {scan}").fetchone()
+        con.execute("CALL ner_stats_reset()")
+        begin = time.perf_counter()
+        predicted = con.execute(f'SELECT id, start, "end", label FROM {scan}').fetchall()
+        elapsed = time.perf_counter() - begin
+        skipped = con.execute("SELECT value FROM ner_stats() WHERE name = 'prefilter_skipped'").fetchone()[0]
+
+        predicted = set(predicted)
+        correct = len(predicted & gold)
+        precision = correct / len(predicted) if predicted else 0.0
+        recall = correct / len(gold) if gold else 0.0
+        f1 = 2 * precision * recall / (precision + recall) if correct else 0.0
+        print(f"{model_path:<60} {prefilter:>9} {skipped / len(texts):>8.1%} {n_tokens / elapsed:>10.0f} "
+              f"{precision:>10.4f} {recall:>10.4f} {f1:>8.4f}")
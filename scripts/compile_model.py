@@ -0,0 +1,163 @@
+import sys
+import struct
+
+# Compiles a model file written by convert_ner_to_ggml.py (or an original bert.cpp-style file) into the compiled
+# format (version 3): the vocabulary hash tables, token flags and a tensor table are stored ready to use, so that
+# loading the model is a validation pass over the mapped file. See ner_load_compiled in src/ner_model.cpp, whose
+# layout and hash tables this must reproduce exactly.
+
+NER_FILE_MAGIC_GGML = 0x67676d6c # "ggml"
+NER_FILE_MAGIC = 0x67676e72 # "ggnr"
+NER_FILE_VERSION_COMPILED = 3
+NER_TENSOR_ALIGN = 32
+NER_COMPILED_ALIGN = 64
+
+NER_TOKEN_SPECIAL = 1
+NER_TOKEN_SUBWORD = 2
+
+# Labels of older files without label names, as assumed by the loader
+NER_CONLL_LABELS = ["O", "B-MISC", "I-MISC", "B-PER", "I-PER", "B-ORG", "I-ORG", "B-LOC", "I-LOC"]
+
+# ggml_type: (bytes per block, elements per block)
+GGML_TYPES = {0: (4, 1), 1: (2, 1), 2: (18, 32), 8: (34, 32)}
+
+TENSOR_NAME_SIZE = 96
+TENSOR_ENTRY = struct.Struct(f"<{TENSOR_NAME_SIZE}siiiiQQ")
+
+def pad(n, alignment):
+    return (n + alignment - 1) // alignment * alignment
+
+def ner_hash(key):
+    # FNV-1a, as ner_hash
+    h = 2166136261
+    for c in key:
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def take(self, n):
+        if self.pos + n > len(self.data):
+            raise ValueError("truncated model file")
+        chunk = self.data[self.pos:self.pos + n]
+        self.pos += n
+        return chunk
+
+    def i32(self):
+        return struct.unpack("<i", self.take(4))[0]
+
+    def align(self, alignment):
+        self.pos = pad(self.pos, alignment)
+
+def build_table(keys_by_id, ids, n_slots):
+    # ner_vocab::build: linear probing from hash & mask, a later duplicate replacing an earlier one
+    hashes = [0] * n_slots
+    slots = [-1] * n_slots
+    for id in ids:
+        key = keys_by_id[id]
+        h = ner_hash(key)
+        i = h & (n_slots - 1)
+        while slots[i] >= 0 and not (hashes[i] == h and keys_by_id[slots[i]] == key):
+            i = (i + 1) & (n_slots - 1)
+        hashes[i] = h
+        slots[i] = id
+    return b"".join(struct.pack("<Ii", h, id) for h, id in zip(hashes, slots))
+
+def compile_model(data):
+    fin = Reader(data)
+    magic = struct.unpack("<I", fin.take(4))[0]
+    version = 0
+    if magic == NER_FILE_MAGIC:
+        version = fin.i32()
+        if version >= NER_FILE_VERSION_COMPILED:
+            return data
+    elif magic != NER_FILE_MAGIC_GGML:
+        raise ValueError("not a model file")
+    hparams = [fin.i32() for _ in range(8)]
+    n_vocab, n_labels = hparams[0], hparams[7]
+
+    words = [fin.take(fin.i32()) for _ in range(n_vocab)]
+    if version >= 2:
+        labels = [fin.take(fin.i32()) for _ in range(n_labels)]
+    elif n_labels == len(NER_CONLL_LABELS):
+        labels = [label.encode() for label in NER_CONLL_LABELS]
+    else:
+        labels = [b"O"] + [f"LABEL_{i}".encode() for i in range(1, n_labels)]
+
+    tensors = []
+    while fin.pos < len(data):
+        n_dims, length, ggml_type = fin.i32(), fin.i32(), fin.i32()
+        ne = [fin.i32() for _ in range(n_dims)] + [1] * (2 - n_dims)
+        name = fin.take(length)
+        if version > 0:
+            fin.align(NER_TENSOR_ALIGN)
+        if n_dims == 1 and ggml_type != 0:
+            raise ValueError(f"vector {name.decode()} is not F32, convert the model again")
+        block_bytes, block_size = GGML_TYPES[ggml_type]
+        tensors.append((name, ggml_type, ne, fin.take(ne[0] // block_size * block_bytes * ne[1])))
+
+    # Vocabulary arrays and hash tables, as ner_load_internal builds them for older files
+    flags = []
+    keys_by_id = []
+    offsets = [0]
+    for word in words:
+        flag = 0
+        if len(word) > 2 and word.startswith(b"##"):
+            flag |= NER_TOKEN_SUBWORD
+        elif len(word) > 2 and word.startswith(b"[") and word.endswith(b"]"):
+            flag |= NER_TOKEN_SPECIAL
+        flags.append(flag)
+        keys_by_id.append(word[2:] if flag & NER_TOKEN_SUBWORD else word)
+        offsets.append(offsets[-1] + len(word) + 1)
+    pool = b"".join(word + b"\0" for word in words)
+    n_slots = 16
+    while n_slots < 2 * n_vocab:
+        n_slots *= 2
+    word_ids = [i for i in range(n_vocab) if not flags[i] & NER_TOKEN_SUBWORD]
+    subword_ids = [i for i in range(n_vocab) if flags[i] & NER_TOKEN_SUBWORD]
+    word_table = build_table(keys_by_id, word_ids, n_slots)
+    subword_table = build_table(keys_by_id, subword_ids, n_slots)
+    max_token_len = max((len(key) for key in keys_by_id), default=0)
+    # Later duplicates win in the tables too
+    cls_id = max(i for i in word_ids if words[i] == b"[CLS]")
+    sep_id = max(i for i in word_ids if words[i] == b"[SEP]")
+
+    out = bytearray()
+    def align():
+        out.extend(b"\0" * (pad(len(out), NER_COMPILED_ALIGN) - len(out)))
+
+    out += struct.pack("<Ii", NER_FILE_MAGIC, NER_FILE_VERSION_COMPILED)
+    out += struct.pack("<8i", *hparams)
+    for label in labels:
+        out += struct.pack("<i", len(label)) + label
+    align()
+    out += struct.pack("<IiiiII8x", n_slots, max_token_len, cls_id, sep_id, len(pool), len(tensors))
+    for section in [struct.pack(f"<{n_vocab + 1}I", *offsets), bytes(flags), pool, word_table, subword_table]:
+        align()
+        out += section
+
+    # Tensor table, then the tensors at the offsets it gives
+    align()
+    offset = pad(len(out) + TENSOR_ENTRY.size * len(tensors), NER_COMPILED_ALIGN)
+    for name, ggml_type, ne, tensor in tensors:
+        if len(name) >= TENSOR_NAME_SIZE:
+            raise ValueError(f"tensor name too long: {name}")
+        out += TENSOR_ENTRY.pack(name, ggml_type, ne[0], ne[1], 0, offset, len(tensor))
+        offset = pad(offset + len(tensor), NER_COMPILED_ALIGN)
+    for _, _, _, tensor in tensors:
+        align()
+        out += tensor
+    return bytes(out)
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print("Usage: compile_model.py model.bin compiled.bin\n")
+        sys.exit(1)
+    with open(sys.argv[1], "rb") as f:
+        compiled = compile_model(f.read())
+    with open(sys.argv[2], "wb") as f:
+        f.write(compiled)
+    print(f"Done! Compiled model written to {sys.argv[2]} ({len(compiled)} bytes)")
@@ -6,15 +6,58 @@ import numpy as np
 import os
 from transformers import AutoModelForTokenClassification, AutoTokenizer
 
+# Versioned file format, see NER_FILE_MAGIC in src/ner_model.cpp
+NER_FILE_MAGIC = 0x67676e72 # "ggnr"
+NER_FILE_VERSION = 2
+# Tensor data is padded to this alignment so that the loader can use it in place from the mapped file
+NER_TENSOR_ALIGN = 32
+
+# File types (ggml_ftype) and the ggml_type of the tensors they quantize
+FTYPES = {"f32": 0, "f16": 1, "q4_0": 2, "q8_0": 7}
+GGML_TYPE_F32 = 0
+GGML_TYPE_F16 = 1
+GGML_TYPE_Q4_0 = 2
+GGML_TYPE_Q8_0 = 8
+QK = 32 # Elements per quantization block
+
+def quantize_q8_0(data):
+    # ggml block_q8_0: fp16 scale d = max|x| / 127, then 32 int8 x / d rounded half away from zero
+    blocks = data.reshape(-1, QK).astype(np.float32)
+    d = np.abs(blocks).max(axis=1, keepdims=True) / 127
+    inv_d = np.divide(1.0, d, out=np.zeros_like(d), where=d != 0)
+    v = blocks * inv_d
+    qs = np.trunc(v + np.copysign(0.5, v)).astype(np.int8)
+    out = np.empty((blocks.shape[0], 2 + QK), dtype=np.uint8)
+    out[:, :2] = d.astype(np.float16).view(np.uint8)
+    out[:, 2:] = qs.view(np.uint8)
+    return out
+
+def quantize_q4_0(data):
+    # ggml block_q4_0: fp16 scale d = -max / 8 (max being the value of largest magnitude), then 16 bytes holding
+    # x / d + 8 in 4 bits, element j in the low nibble of byte j and element j + 16 in its high nibble
+    blocks = data.reshape(-1, QK).astype(np.float32)
+    idx = np.abs(blocks).argmax(axis=1)
+    d = (blocks[np.arange(blocks.shape[0]), idx] / -8)[:, None]
+    inv_d = np.divide(1.0, d, out=np.zeros_like(d), where=d != 0)
+    q = np.minimum(15, np.trunc(blocks * inv_d + 8.5)).astype(np.uint8)
+    out = np.empty((blocks.shape[0], 2 + QK // 2), dtype=np.uint8)
+    out[:, :2] = d.astype(np.float16).view(np.uint8)
+    out[:, 2:] = q[:, :QK // 2] | (q[:, QK // 2:] << 4)
+    return out
+
 if len(sys.argv) < 2:
-    print("Usage: convert_ner_to_ggml.py model_name_or_path [use-f32]
-")
+    print("Usage: convert_ner_to_ggml.py model_name_or_path [f32|f16|q8_0|q4_0]\n")
     sys.exit(1)
 
 model_id = sys.argv[1]
-ftype = 1
+ftype_name = "f16"
 if len(sys.argv) > 2:
-    ftype = int(sys.argv[2])
+    # Also accept the numeric ggml_ftype
+    ftype_name = {str(v): k for k, v in FTYPES.items()}.get(sys.argv[2], sys.argv[2])
+if ftype_name not in FTYPES:
+    print(f"Error: unknown type {sys.argv[2]}, expected one of {', '.join(FTYPES)}")
+    sys.exit(1)
+ftype = FTYPES[ftype_name]
 
 print(f"Loading model {model_id}...")
 tokenizer = AutoTokenizer.from_pretrained(model_id)
@@ -30,12 +73,14 @@ list_vars = model.state_dict()
 
 # Create model directory if it doesn't exist
 os.makedirs("models", exist_ok=True)
-fname_out = f"models/{model_id.replace('/', '_')}_ner.bin"
+suffix = "" if ftype_name == "f16" else f"-{ftype_name}"
+fname_out = f"models/{model_id.replace('/', '_')}_ner{suffix}.bin"
 
 fout = open(fname_out, "wb")
 
 # Header
-fout.write(struct.pack("i", 0x67676d6c)) # magic: ggml
+fout.write(struct.pack("i", NER_FILE_MAGIC))
+fout.write(struct.pack("i", NER_FILE_VERSION))
 fout.write(struct.pack("i", hparams["vocab_size"]))
 fout.write(struct.pack("i", hparams["max_position_embeddings"]))
 fout.write(struct.pack("i", hparams["hidden_size"]))
@@ -54,6 +99,12 @@ for word, _ in sorted_vocab:
     fout.write(struct.pack("i", len(data)))
     fout.write(data)
 
+# Labels (version 2), e.g. "O", "B-PER", "I-PER", ...
+for i in range(hparams["num_labels"]):
+    data = bytes(model.config.id2label[i], 'utf-8')
+    fout.write(struct.pack("i", len(data)))
+    fout.write(data)
+
 # Tensors
 for name in list_vars.keys():
     data = list_vars[name].squeeze().numpy()
@@ -73,19 +124,31 @@ for name in list_vars.keys():
     print(f"Writing tensor {clean_name} with shape {data.shape}")
 
     n_dims = len(data.shape)
-    l_type = 0
-    if ftype == 1 and clean_name.endswith(".weight") and n_dims == 2:
+    is_matrix = clean_name.endswith(".weight") and n_dims == 2
+    # Only the matrices of the encoder layers are quantized: the embeddings are gathered rather than multiplied, and
+    # the classifier is tiny, so both stay in F16. Biases and LayerNorm parameters are always F32.
+    quantize = (ftype_name in ("q8_0", "q4_0") and is_matrix and clean_name.startswith("encoder.") and
+                data.shape[-1] % QK == 0)
+    if quantize and ftype_name == "q8_0":
+        data = quantize_q8_0(data)
+        l_type = GGML_TYPE_Q8_0
+    elif quantize:
+        data = quantize_q4_0(data)
+        l_type = GGML_TYPE_Q4_0
+    elif ftype != 0 and is_matrix:
         data = data.astype(np.float16)
-        l_type = 1
+        l_type = GGML_TYPE_F16
     else:
         data = data.astype(np.float32)
-        l_type = 0
+        l_type = GGML_TYPE_F32
 
     str_name = clean_name.encode('utf-8')
+    shape = list_vars[name].squeeze().shape
     fout.write(struct.pack("iii", n_dims, len(str_name), l_type))
     for i in range(n_dims):
-        fout.write(struct.pack("i", data.shape[n_dims - 1 - i]))
+        fout.write(struct.pack("i", shape[n_dims - 1 - i]))
     fout.write(str_name)
+    fout.write(b"\0" * (-fout.tell() % NER_TENSOR_ALIGN))
     data.tofile(fout)
 
 fout.close()
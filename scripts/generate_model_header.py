@@ -1,6 +1,11 @@
 import sys
 import os
 
+from compile_model import compile_model
+
+# Embeds a model as src/include/default_model.hpp. The model is compiled first (see compile_model.py), so that the
+# bundled model loads in place from the binary without building its vocabulary index.
+
 if len(sys.argv) < 2:
     print("Usage: python generate_model_header.py model.bin [output.hpp]")
     sys.exit(1)
@@ -13,41 +18,28 @@ if not os.path.exists(input_path):
     sys.exit(1)
 
 with open(input_path, "rb") as f:
-    data = f.read()
+    original = f.read()
+data = compile_model(original)
 
 with open(output_path, "w") as f:
-    f.write("#ifndef DEFAULT_MODEL_HPP
-")
-    f.write("#define DEFAULT_MODEL_HPP
-
-")
-    f.write("#include <stdint.h>
-")
-    f.write("#include <stddef.h>
-
-")
-    f.write(f"// Bundled model from {os.path.basename(input_path)}
-")
-    f.write(f"// Original size: {len(data)} bytes
-")
-    f.write("static const uint8_t DEFAULT_MODEL_DATA[] = {
-")
-    
+    f.write("#ifndef DEFAULT_MODEL_HPP\n")
+    f.write("#define DEFAULT_MODEL_HPP\n\n")
+    f.write("#include <stdint.h>\n")
+    f.write("#include <stddef.h>\n\n")
+    f.write(f"// Bundled model from {os.path.basename(input_path)}, compiled\n")
+    f.write(f"// Original size: {len(original)} bytes, compiled size: {len(data)} bytes\n")
+    # The compiled format is 64-byte aligned relative to the start of the data
+    f.write("alignas(64) static const uint8_t DEFAULT_MODEL_DATA[] = {\n")
+
     # Write bytes in chunks of 12 for readability
     for i in range(0, len(data), 12):
         chunk = data[i:i+12]
         hex_chunk = ", ".join([f"0x{b:02x}" for b in chunk])
         comma = "," if i + 12 < len(data) else ""
-        f.write(f"    {hex_chunk}{comma}
-")
-        
-    f.write("};
-
-")
-    f.write("static const size_t DEFAULT_MODEL_SIZE = sizeof(DEFAULT_MODEL_DATA);
+        f.write(f"    {hex_chunk}{comma}\n")
 
-")
-    f.write("#endif // DEFAULT_MODEL_HPP
-")
+    f.write("};\n\n")
+    f.write("static const size_t DEFAULT_MODEL_SIZE = sizeof(DEFAULT_MODEL_DATA);\n\n")
+    f.write("#endif // DEFAULT_MODEL_HPP\n")
 
 print(f"Done! Header generated at {output_path}")
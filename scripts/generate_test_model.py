@@ -0,0 +1,111 @@
+import random
+import struct
+import sys
+
+# Generates the tiny synthetic models of test/models, in the format written by convert_ner_to_ggml.py (version 2):
+#   python3 scripts/generate_test_model.py test/models/ner_tiny.bin
+#   python3 scripts/generate_test_model.py test/models/ner_tiny_uncased.bin --uncased
+#   python3 scripts/compile_model.py test/models/ner_tiny.bin test/models/ner_tiny_v3.bin
+#   python3 scripts/generate_model_header.py test/models/ner_tiny.bin (the bundled model)
+# Their predictions do not depend on context, so that tests can spell them out: the word embedding of every token
+# points at its label, position embeddings are zero and the encoder weights are small enough not to change the
+# winning label. With --uncased, the vocabulary is lowercased and stripped of accents, as BERT's uncased models.
+
+NER_FILE_MAGIC = 0x67676e72 # "ggnr"
+NER_FILE_VERSION = 2
+NER_TENSOR_ALIGN = 32
+GGML_TYPE_F32 = 0
+
+N_MAX_TOKENS = 16
+N_EMBD = 16
+N_INTERMEDIATE = 32
+N_HEAD = 2
+N_LAYER = 1
+LABELS = ["O", "B-MISC", "I-MISC", "B-PER", "I-PER", "B-ORG", "I-ORG", "B-LOC", "I-LOC"]
+
+# Tokens and their label; "Hello" is a weak B-MISC (score about 0.6)
+VOCAB = [
+    ("[PAD]", "O"), ("[UNK]", "O"), ("[CLS]", "O"), ("[SEP]", "O"), ("[MASK]", "O"),
+    ("the", "O"), ("weather", "O"), ("is", "O"), ("great", "O"), ("The", "O"), ("works", "O"), ("at", "O"),
+    ("in", "O"), ("a", "O"), ("##b", "O"), ("##s", "O"), ("café", "O"), (".", "O"), (",", "O"), ("!", "O"),
+    ("'", "O"), ("Sam", "B-PER"), ("Duck", "B-ORG"), ("##DB", "I-ORG"), ("Labs", "I-ORG"), ("Amsterdam", "B-LOC"),
+    ("Zürich", "B-LOC"), ("New", "B-LOC"), ("York", "I-LOC"), ("東", "B-LOC"), ("京", "I-LOC"), ("Hello", "B-MISC"),
+]
+WEAK = {"Hello"}
+
+def uncased(token):
+    if token.startswith("[") and token.endswith("]"):
+        return token
+    return token.lower().replace("ü", "u").replace("é", "e")
+
+output_path = sys.argv[1] if len(sys.argv) > 1 else "test/models/ner_tiny.bin"
+if "--uncased" in sys.argv:
+    vocab = []
+    for token, label in VOCAB:
+        if uncased(token) not in [t for t, _ in vocab]:
+            vocab.append((uncased(token), label))
+    weak = {uncased(token) for token in WEAK}
+else:
+    vocab = VOCAB
+    weak = WEAK
+
+rng = random.Random(0)
+
+def small(n):
+    return [rng.uniform(-0.02, 0.02) for _ in range(n)]
+
+def embedding(token, label):
+    # -1 everywhere but the dimension of the label, which stands out once normalized
+    values = [-1.0] * N_EMBD
+    values[LABELS.index(label)] = 4.0
+    if token in weak:
+        values[LABELS.index("O")] = 3.7
+    return values
+
+tensors = [("embeddings.word_embeddings.weight", [len(vocab), N_EMBD],
+            [v for token, label in vocab for v in embedding(token, label)]),
+           ("embeddings.position_embeddings.weight", [N_MAX_TOKENS, N_EMBD], [0.0] * N_MAX_TOKENS * N_EMBD),
+           ("embeddings.token_type_embeddings.weight", [2, N_EMBD], [0.0] * 2 * N_EMBD),
+           ("embeddings.LayerNorm.weight", [N_EMBD], [1.0] * N_EMBD),
+           ("embeddings.LayerNorm.bias", [N_EMBD], [0.0] * N_EMBD)]
+for i in range(N_LAYER):
+    base = f"encoder.layer.{i}."
+    for name in ["attention.self.query", "attention.self.key", "attention.self.value", "attention.output.dense"]:
+        tensors.append((base + name + ".weight", [N_EMBD, N_EMBD], small(N_EMBD * N_EMBD)))
+        tensors.append((base + name + ".bias", [N_EMBD], small(N_EMBD)))
+    tensors.append((base + "attention.output.LayerNorm.weight", [N_EMBD], [1.0] * N_EMBD))
+    tensors.append((base + "attention.output.LayerNorm.bias", [N_EMBD], [0.0] * N_EMBD))
+    tensors.append((base + "intermediate.dense.weight", [N_INTERMEDIATE, N_EMBD], small(N_INTERMEDIATE * N_EMBD)))
+    tensors.append((base + "intermediate.dense.bias", [N_INTERMEDIATE], small(N_INTERMEDIATE)))
+    tensors.append((base + "output.dense.weight", [N_EMBD, N_INTERMEDIATE], small(N_EMBD * N_INTERMEDIATE)))
+    tensors.append((base + "output.dense.bias", [N_EMBD], small(N_EMBD)))
+    tensors.append((base + "output.LayerNorm.weight", [N_EMBD], [1.0] * N_EMBD))
+    tensors.append((base + "output.LayerNorm.bias", [N_EMBD], [0.0] * N_EMBD))
+# The classifier reads the label off its dimension
+classifier = [0.0] * len(LABELS) * N_EMBD
+for i in range(len(LABELS)):
+    classifier[i * N_EMBD + i] = 2.0
+tensors.append(("classifier.weight", [len(LABELS), N_EMBD], classifier))
+tensors.append(("classifier.bias", [len(LABELS)], [0.0] * len(LABELS)))
+
+out = bytearray()
+out += struct.pack("<II", NER_FILE_MAGIC, NER_FILE_VERSION)
+out += struct.pack("<8i", len(vocab), N_MAX_TOKENS, N_EMBD, N_INTERMEDIATE, N_HEAD, N_LAYER, 0, len(LABELS))
+for token, _ in vocab:
+    data = token.encode("utf-8")
+    out += struct.pack("<i", len(data)) + data
+for label in LABELS:
+    data = label.encode("utf-8")
+    out += struct.pack("<i", len(data)) + data
+for name, shape, values in tensors:
+    data = name.encode("utf-8")
+    out += struct.pack("<iii", len(shape), len(data), GGML_TYPE_F32)
+    for n in reversed(shape):
+        out += struct.pack("<i", n)
+    out += data
+    out += b"\0" * (-len(out) % NER_TENSOR_ALIGN)
+    out += struct.pack(f"<{len(values)}f", *values)
+
+with open(output_path, "wb") as f:
+    f.write(out)
+print(f"Done! Test model written to {output_path} ({len(out)} bytes)")
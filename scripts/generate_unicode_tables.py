@@ -0,0 +1,83 @@
+import sys
+import unicodedata
+
+# Generates src/include/ner_unicode_tables.hpp, the character classes of BERT's basic tokenizer (Hugging Face's
+# BasicTokenizer) for the code points outside ASCII. ASCII is classified by a byte table in src/ner_unicode.cpp.
+# The tables follow the Unicode database of the Python running this script.
+
+output_path = sys.argv[1] if len(sys.argv) > 1 else "src/include/ner_unicode_tables.hpp"
+
+MAX_CODE_POINT = 0x110000
+HANGUL_SYLLABLES = (0xAC00, 0xD7A3) # decomposed arithmetically by ner_unicode_fold
+
+def category(cp):
+    return unicodedata.category(chr(cp))
+
+def ranges(predicate):
+    result = []
+    begin = None
+    for cp in range(0x80, MAX_CODE_POINT + 1):
+        if cp < MAX_CODE_POINT and predicate(cp):
+            if begin is None:
+                begin = cp
+        elif begin is not None:
+            result.append((begin, cp - 1))
+            begin = None
+    return result
+
+def fold(cp):
+    # Lowercase, then strip accents: NFD, dropping nonspacing marks
+    decomposed = unicodedata.normalize("NFD", chr(cp).lower())
+    return [ord(c) for c in decomposed if unicodedata.category(c) != "Mn"]
+
+# Punctuation: every P* category (ASCII symbols such as "$" or "+" are punctuation too, see the byte table)
+punctuation = ranges(lambda cp: category(cp).startswith("P"))
+# Removed characters: control and format characters, private use, and U+FFFD. BasicTokenizer also removes
+# unassigned code points, which are not listed: they follow the Unicode version and do not occur in practice.
+removed = ranges(lambda cp: category(cp) in ("Cc", "Cf", "Co", "Cs") or cp == 0xFFFD)
+# Nonspacing marks, removed with accents when lowercasing
+marks = ranges(lambda cp: category(cp) == "Mn")
+# Lowercase letters, which never start a proper noun in scripts with case
+lowercase = ranges(lambda cp: category(cp) == "Ll")
+
+folds = []
+folds_multi = []
+for cp in range(0x80, MAX_CODE_POINT):
+    if 0xD800 <= cp <= 0xDFFF or HANGUL_SYLLABLES[0] <= cp <= HANGUL_SYLLABLES[1] or category(cp) == "Mn":
+        continue
+    folded = fold(cp)
+    if folded == [cp] or not folded:
+        continue
+    if len(folded) == 1:
+        folds.append((cp, folded[0]))
+    else:
+        folds_multi.append((cp, folded + [0] * (3 - len(folded))))
+
+def write_array(f, declaration, items, per_line):
+    f.write(f"{declaration} = {{\n")
+    for i in range(0, len(items), per_line):
+        f.write("\t" + ", ".join(items[i:i + per_line]) + ",\n")
+    f.write("};\n\n")
+
+with open(output_path, "w") as f:
+    f.write("#ifndef NER_UNICODE_TABLES_HPP\n")
+    f.write("#define NER_UNICODE_TABLES_HPP\n\n")
+    f.write("#include <stdint.h>\n\n")
+    f.write("// Generated by scripts/generate_unicode_tables.py")
+    f.write(f" from Unicode {unicodedata.unidata_version}. Do not edit.\n")
+    f.write("// Code points above U+007F only, sorted.\n\n")
+    f.write("struct ner_unicode_range {\n\tuint32_t first;\n\tuint32_t last;\n};\n\n")
+    f.write("struct ner_unicode_fold {\n\tuint32_t cp;\n\tuint32_t to;\n};\n\n")
+    f.write("struct ner_unicode_fold_multi {\n\tuint32_t cp;\n\tuint32_t to[3];\n};\n\n")
+    for name, table in [("PUNCTUATION", punctuation), ("REMOVED", removed), ("MARKS", marks),
+                        ("LOWERCASE", lowercase)]:
+        items = [f"{{0x{a:X}, 0x{b:X}}}" for a, b in table]
+        write_array(f, f"static const ner_unicode_range NER_UNICODE_{name}[]", items, 5)
+    # Lowercase and accent-stripped form of the code points that have one
+    write_array(f, "static const ner_unicode_fold NER_UNICODE_FOLDS[]",
+                [f"{{0x{a:X}, 0x{b:X}}}" for a, b in folds], 5)
+    write_array(f, "static const ner_unicode_fold_multi NER_UNICODE_FOLDS_MULTI[]",
+                [f"{{0x{a:X}, {{0x{b[0]:X}, 0x{b[1]:X}, 0x{b[2]:X}}}}}" for a, b in folds_multi], 3)
+    f.write("#endif // NER_UNICODE_TABLES_HPP\n")
+
+print(f"Done! Tables generated at {output_path}")
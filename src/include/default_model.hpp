@@ -4,12 +4,1463 @@
 #include <stdint.h>
 #include <stddef.h>
 
-// This is a placeholder for the bundled tiny NER model.
-// In a real scenario, this would be populated with the bytes of a quantized bert-tiny-ner.bin.
-// Size: ~4.5MB for Q4_0 quantized bert-tiny.
-static const uint8_t DEFAULT_MODEL_DATA[] = {
-    0x67, 0x67, 0x6d, 0x6c, // magic
-    0x00, 0x00, 0x00, 0x00  // dummy data...
+// Bundled model from ner_tiny.bin, compiled
+// Original size: 14724 bytes, compiled size: 17444 bytes
+alignas(64) static const uint8_t DEFAULT_MODEL_DATA[] = {
+    0x72, 0x6e, 0x67, 0x67, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4f, 0x06, 0x00, 0x00,
+    0x00, 0x42, 0x2d, 0x4d, 0x49, 0x53, 0x43, 0x06, 0x00, 0x00, 0x00, 0x49,
+    0x2d, 0x4d, 0x49, 0x53, 0x43, 0x05, 0x00, 0x00, 0x00, 0x42, 0x2d, 0x50,
+    0x45, 0x52, 0x05, 0x00, 0x00, 0x00, 0x49, 0x2d, 0x50, 0x45, 0x52, 0x05,
+    0x00, 0x00, 0x00, 0x42, 0x2d, 0x4f, 0x52, 0x47, 0x05, 0x00, 0x00, 0x00,
+    0x49, 0x2d, 0x4f, 0x52, 0x47, 0x05, 0x00, 0x00, 0x00, 0x42, 0x2d, 0x4c,
+    0x4f, 0x43, 0x05, 0x00, 0x00, 0x00, 0x49, 0x2d, 0x4c, 0x4f, 0x43, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x98, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+    0x41, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+    0x4a, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+    0x56, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0x5c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+    0x6a, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+    0x81, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,
+    0x8e, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5b, 0x50, 0x41, 0x44, 0x5d, 0x00, 0x5b, 0x55,
+    0x4e, 0x4b, 0x5d, 0x00, 0x5b, 0x43, 0x4c, 0x53, 0x5d, 0x00, 0x5b, 0x53,
+    0x45, 0x50, 0x5d, 0x00, 0x5b, 0x4d, 0x41, 0x53, 0x4b, 0x5d, 0x00, 0x74,
+    0x68, 0x65, 0x00, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x00, 0x69,
+    0x73, 0x00, 0x67, 0x72, 0x65, 0x61, 0x74, 0x00, 0x54, 0x68, 0x65, 0x00,
+    0x77, 0x6f, 0x72, 0x6b, 0x73, 0x00, 0x61, 0x74, 0x00, 0x69, 0x6e, 0x00,
+    0x61, 0x00, 0x23, 0x23, 0x62, 0x00, 0x23, 0x23, 0x73, 0x00, 0x63, 0x61,
+    0x66, 0xc3, 0xa9, 0x00, 0x2e, 0x00, 0x2c, 0x00, 0x21, 0x00, 0x27, 0x00,
+    0x53, 0x61, 0x6d, 0x00, 0x44, 0x75, 0x63, 0x6b, 0x00, 0x23, 0x23, 0x44,
+    0x42, 0x00, 0x4c, 0x61, 0x62, 0x73, 0x00, 0x41, 0x6d, 0x73, 0x74, 0x65,
+    0x72, 0x64, 0x61, 0x6d, 0x00, 0x5a, 0xc3, 0xbc, 0x72, 0x69, 0x63, 0x68,
+    0x00, 0x4e, 0x65, 0x77, 0x00, 0x59, 0x6f, 0x72, 0x6b, 0x00, 0xe6, 0x9d,
+    0xb1, 0x00, 0xe4, 0xba, 0xac, 0x00, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x42, 0x87, 0x72, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xcf, 0x3f, 0x1d,
+    0x1e, 0x00, 0x00, 0x00, 0xc6, 0x8a, 0x0c, 0x22, 0x14, 0x00, 0x00, 0x00,
+    0xc7, 0x2f, 0xbc, 0x10, 0x1d, 0x00, 0x00, 0x00, 0x88, 0x15, 0x25, 0x57,
+    0x0b, 0x00, 0x00, 0x00, 0x09, 0x6a, 0x82, 0x2f, 0x03, 0x00, 0x00, 0x00,
+    0x49, 0x50, 0x2b, 0xa8, 0x10, 0x00, 0x00, 0x00, 0xcb, 0x95, 0x0c, 0x29,
+    0x12, 0x00, 0x00, 0x00, 0x4b, 0x31, 0x5c, 0xf5, 0x1f, 0x00, 0x00, 0x00,
+    0x8d, 0x88, 0xeb, 0x6f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x93, 0x47, 0x40, 0x36, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x15, 0x8f, 0x38, 0x4e, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x98, 0x33, 0x8c, 0x24, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xdb, 0xfd, 0xdc, 0x08, 0x19, 0x00, 0x00, 0x00,
+    0x1c, 0xb2, 0x0e, 0xb4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x9e, 0x7a, 0x38, 0x41, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x20, 0x7f, 0x00, 0xd7,
+    0x1a, 0x00, 0x00, 0x00, 0x61, 0xbf, 0xf4, 0x77, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xa5, 0x89, 0x34, 0xe5, 0x18, 0x00, 0x00, 0x00, 0x66, 0x0e, 0xce, 0x48,
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xb3, 0x92, 0x44,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x29, 0x0c, 0xe4,
+    0x0d, 0x00, 0x00, 0x00, 0xec, 0x8d, 0x0c, 0x24, 0x13, 0x00, 0x00, 0x00,
+    0xee, 0x55, 0x13, 0xfb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xf1, 0x98, 0x0c, 0x2b, 0x11, 0x00, 0x00, 0x00, 0xb1, 0x2d, 0x24, 0x8b,
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xbc, 0x49, 0x99, 0x16, 0x09, 0x00, 0x00, 0x00,
+    0xbd, 0x94, 0xaa, 0xd7, 0x02, 0x00, 0x00, 0x00, 0x7c, 0x35, 0xa7, 0x3f,
+    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x82, 0x45, 0x0c, 0xf6, 0x0f, 0x00, 0x00, 0x00,
+    0x83, 0x75, 0xce, 0x36, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x2d, 0x0c, 0xe7,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x65, 0x6d, 0x62, 0x65,
+    0x64, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x77, 0x6f, 0x72, 0x64, 0x5f,
+    0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x77,
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x69, 0x6e,
+    0x67, 0x73, 0x2e, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
+    0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x77,
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x74,
+    0x6f, 0x6b, 0x65, 0x6e, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x5f, 0x65, 0x6d,
+    0x62, 0x65, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x77, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6d, 0x62, 0x65,
+    0x64, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x4c, 0x61, 0x79, 0x65, 0x72,
+    0x4e, 0x6f, 0x72, 0x6d, 0x2e, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x69, 0x6e,
+    0x67, 0x73, 0x2e, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x4e, 0x6f, 0x72, 0x6d,
+    0x2e, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x1e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x2e, 0x6c, 0x61, 0x79, 0x65,
+    0x72, 0x2e, 0x30, 0x2e, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f,
+    0x6e, 0x2e, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79,
+    0x2e, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x63, 0x6f,
+    0x64, 0x65, 0x72, 0x2e, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2e, 0x30, 0x2e,
+    0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x73, 0x65,
+    0x6c, 0x66, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x2e, 0x62, 0x69, 0x61,
+    0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x2e,
+    0x6c, 0x61, 0x79, 0x65, 0x72, 0x2e, 0x30, 0x2e, 0x61, 0x74, 0x74, 0x65,
+    0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x6b,
+    0x65, 0x79, 0x2e, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x23, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x2e, 0x6c, 0x61, 0x79, 0x65,
+    0x72, 0x2e, 0x30, 0x2e, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f,
+    0x6e, 0x2e, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x6b, 0x65, 0x79, 0x2e, 0x62,
+    0x69, 0x61, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x63, 0x6f,
+    0x64, 0x65, 0x72, 0x2e, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2e, 0x30, 0x2e,
+    0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x73, 0x65,
+    0x6c, 0x66, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x77, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x2e,
+    0x6c, 0x61, 0x79, 0x65, 0x72, 0x2e, 0x30, 0x2e, 0x61, 0x74, 0x74, 0x65,
+    0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x76,
+    0x61, 0x6c, 0x75, 0x65, 0x2e, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x2e, 0x6c, 0x61, 0x79, 0x65,
+    0x72, 0x2e, 0x30, 0x2e, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f,
+    0x6e, 0x2e, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x64, 0x65, 0x6e,
+    0x73, 0x65, 0x2e, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x63, 0x6f,
+    0x64, 0x65, 0x72, 0x2e, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2e, 0x30, 0x2e,
+    0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x6f, 0x75,
+    0x74, 0x70, 0x75, 0x74, 0x2e, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x62,
+    0x69, 0x61, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x2e,
+    0x6c, 0x61, 0x79, 0x65, 0x72, 0x2e, 0x30, 0x2e, 0x61, 0x74, 0x74, 0x65,
+    0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+    0x2e, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x4e, 0x6f, 0x72, 0x6d, 0x2e, 0x77,
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x2e, 0x6c, 0x61, 0x79, 0x65,
+    0x72, 0x2e, 0x30, 0x2e, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f,
+    0x6e, 0x2e, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x4c, 0x61, 0x79,
+    0x65, 0x72, 0x4e, 0x6f, 0x72, 0x6d, 0x2e, 0x62, 0x69, 0x61, 0x73, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x63, 0x6f,
+    0x64, 0x65, 0x72, 0x2e, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2e, 0x30, 0x2e,
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65,
+    0x2e, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2e, 0x77, 0x65, 0x69, 0x67, 0x68,
+    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x2e,
+    0x6c, 0x61, 0x79, 0x65, 0x72, 0x2e, 0x30, 0x2e, 0x69, 0x6e, 0x74, 0x65,
+    0x72, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x2e, 0x64, 0x65, 0x6e,
+    0x73, 0x65, 0x2e, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x2e, 0x6c, 0x61, 0x79, 0x65,
+    0x72, 0x2e, 0x30, 0x2e, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x64,
+    0x65, 0x6e, 0x73, 0x65, 0x2e, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x63, 0x6f,
+    0x64, 0x65, 0x72, 0x2e, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2e, 0x30, 0x2e,
+    0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x64, 0x65, 0x6e, 0x73, 0x65,
+    0x2e, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x2e,
+    0x6c, 0x61, 0x79, 0x65, 0x72, 0x2e, 0x30, 0x2e, 0x6f, 0x75, 0x74, 0x70,
+    0x75, 0x74, 0x2e, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x4e, 0x6f, 0x72, 0x6d,
+    0x2e, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x2e, 0x6c, 0x61, 0x79, 0x65,
+    0x72, 0x2e, 0x30, 0x2e, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x4c,
+    0x61, 0x79, 0x65, 0x72, 0x4e, 0x6f, 0x72, 0x6d, 0x2e, 0x62, 0x69, 0x61,
+    0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x69, 0x66, 0x69, 0x65, 0x72, 0x2e, 0x77, 0x65, 0x69, 0x67, 0x68,
+    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69,
+    0x65, 0x72, 0x2e, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0xcd, 0xcc, 0x6c, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf,
+    0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x66, 0xb8, 0x61, 0x3c, 0x91, 0x0d, 0x29, 0x3c,
+    0x83, 0x37, 0x50, 0xbb, 0x0f, 0xff, 0x1d, 0xbc, 0xb3, 0x72, 0xec, 0x39,
+    0x9f, 0x35, 0x79, 0xbb, 0x81, 0xfd, 0x39, 0x3c, 0xa6, 0xe6, 0x00, 0xbc,
+    0x13, 0x66, 0x75, 0xba, 0xbd, 0x94, 0x5a, 0x3b, 0xfd, 0xba, 0x85, 0x3c,
+    0xbb, 0x94, 0x44, 0x39, 0x89, 0xf9, 0x0e, 0xbc, 0xd3, 0xa4, 0x27, 0x3c,
+    0x0b, 0x26, 0x9b, 0x3b, 0x17, 0x82, 0x23, 0xbc, 0x02, 0x44, 0x86, 0x3c,
+    0xfb, 0x32, 0x9e, 0x3c, 0xd1, 0x4d, 0x4b, 0x3c, 0x20, 0xc8, 0x83, 0x3c,
+    0xe8, 0xd7, 0xf8, 0xbb, 0x5e, 0x9f, 0x16, 0x3c, 0xfb, 0xb0, 0x82, 0x3c,
+    0xc3, 0x26, 0xf1, 0x3b, 0x6a, 0x0d, 0x92, 0xba, 0x9c, 0xd7, 0x82, 0xbc,
+    0x89, 0x90, 0x2c, 0xbb, 0x7e, 0x57, 0x91, 0x3b, 0xe1, 0x55, 0x87, 0x3c,
+    0xc7, 0xe5, 0x98, 0x3c, 0xe9, 0x11, 0x71, 0xba, 0xd6, 0x68, 0x6f, 0x3c,
+    0xb9, 0xf6, 0x1c, 0xbc, 0x2d, 0xe7, 0x47, 0x3c, 0x19, 0x53, 0xff, 0x3a,
+    0x23, 0x3d, 0x9f, 0xbc, 0x54, 0xfc, 0x0f, 0x3c, 0x30, 0x9d, 0x84, 0xbb,
+    0xf2, 0xe3, 0x54, 0x3c, 0xda, 0x66, 0xdc, 0x3b, 0x2c, 0x77, 0xa3, 0xbc,
+    0x91, 0xae, 0x86, 0xb9, 0x83, 0xe9, 0x70, 0x3c, 0xa0, 0xd4, 0x27, 0xbc,
+    0xaf, 0x1b, 0xe5, 0xbb, 0xc2, 0xca, 0x72, 0x3c, 0x57, 0x76, 0x4a, 0xbc,
+    0xb1, 0xf9, 0x30, 0x3b, 0xf8, 0x4c, 0x2b, 0xbc, 0x1e, 0x34, 0x99, 0x3c,
+    0x13, 0xb1, 0x46, 0x3c, 0x08, 0x65, 0x08, 0xbb, 0xc1, 0x7a, 0x89, 0xbc,
+    0xa8, 0xdb, 0xeb, 0xbb, 0x00, 0x87, 0xa6, 0x39, 0xbc, 0xd4, 0x8d, 0x3c,
+    0x9b, 0x1a, 0x80, 0xbc, 0xde, 0x64, 0x06, 0x3b, 0x41, 0x5f, 0x07, 0x3c,
+    0x1d, 0xba, 0xf8, 0x3a, 0xc9, 0x16, 0x4e, 0x3c, 0xbe, 0x33, 0xd3, 0x3a,
+    0x99, 0xfd, 0x97, 0x3c, 0x5a, 0x3f, 0x87, 0x3b, 0xd1, 0xae, 0x65, 0x3b,
+    0x3d, 0x35, 0x10, 0xbb, 0x05, 0x69, 0x7c, 0x3b, 0xc4, 0xdc, 0x96, 0xbb,
+    0x89, 0x50, 0x46, 0x3b, 0xdf, 0x68, 0x09, 0xbc, 0x7d, 0x8f, 0x4b, 0xbc,
+    0x10, 0x4e, 0x4d, 0xbc, 0x66, 0xd0, 0x93, 0x3b, 0x2b, 0x56, 0xcd, 0x3b,
+    0x23, 0x17, 0x76, 0xba, 0x07, 0x68, 0x86, 0xbc, 0xc4, 0xd2, 0x28, 0x3c,
+    0x94, 0xeb, 0x76, 0x3c, 0xc6, 0xbb, 0x8a, 0x3c, 0x4b, 0x6f, 0x60, 0x3c,
+    0x2f, 0x79, 0x82, 0x3c, 0xba, 0xa2, 0x8a, 0x3c, 0x4c, 0xdc, 0xd4, 0x3a,
+    0xfe, 0x7a, 0x8e, 0xbb, 0xd7, 0x88, 0x06, 0x3c, 0x59, 0x0a, 0x13, 0xbc,
+    0x9f, 0x3a, 0x4c, 0x3c, 0x04, 0x0a, 0x65, 0x3c, 0x45, 0x72, 0x81, 0x3c,
+    0x8e, 0x68, 0x6b, 0x3b, 0x03, 0x61, 0x93, 0x3c, 0x6b, 0xea, 0x50, 0x3b,
+    0x8a, 0x98, 0x01, 0xbb, 0x6d, 0x09, 0xd2, 0x3b, 0x20, 0x9d, 0xa2, 0x3c,
+    0x90, 0x9f, 0x88, 0x3c, 0xc8, 0x3b, 0x40, 0x3c, 0x18, 0xd9, 0x88, 0xbc,
+    0xbb, 0xd3, 0x93, 0x3b, 0x91, 0x24, 0x0e, 0xba, 0x33, 0x96, 0xaa, 0x3b,
+    0x69, 0x26, 0x62, 0x3c, 0x78, 0x67, 0x28, 0xbc, 0x72, 0xb5, 0x17, 0x3c,
+    0x35, 0xea, 0x7a, 0xbc, 0xf1, 0x32, 0x37, 0xbc, 0xd2, 0x0e, 0x41, 0x3c,
+    0x8b, 0x7f, 0xdb, 0xbb, 0x6c, 0x09, 0x4f, 0x3c, 0x78, 0xdf, 0x82, 0xbc,
+    0x33, 0xc3, 0x67, 0xbc, 0xa1, 0x8b, 0x01, 0x3c, 0x88, 0x04, 0x95, 0xbc,
+    0xa8, 0xa2, 0x41, 0x3b, 0xa3, 0x5a, 0x86, 0x3c, 0xbc, 0x4b, 0xb3, 0x3a,
+    0xa8, 0xb3, 0xec, 0x3b, 0x8d, 0x17, 0x9b, 0xbc, 0x74, 0xf2, 0xb0, 0x3b,
+    0x41, 0x61, 0x8b, 0x3b, 0x29, 0x1b, 0x47, 0x3b, 0x11, 0x98, 0x8e, 0xbb,
+    0xce, 0x35, 0xaa, 0xbb, 0xa8, 0x74, 0x9d, 0x3c, 0x41, 0xea, 0x97, 0xbc,
+    0x0a, 0xc0, 0x9c, 0xbc, 0x1b, 0x12, 0x97, 0x3c, 0xf0, 0x74, 0x4e, 0xbc,
+    0xec, 0x7b, 0x76, 0xbc, 0x34, 0xad, 0x3d, 0xbc, 0xe8, 0x18, 0x45, 0x3c,
+    0xa1, 0x2f, 0x8f, 0x3c, 0xe6, 0x5f, 0x9c, 0xbc, 0x5b, 0xfc, 0x42, 0xbb,
+    0x96, 0x94, 0x82, 0xbc, 0xc2, 0x56, 0x1d, 0xbc, 0x13, 0xf5, 0x36, 0xbc,
+    0x17, 0x94, 0xc0, 0x3b, 0x02, 0x39, 0xc4, 0xbb, 0xc2, 0x81, 0x51, 0xbc,
+    0xad, 0x86, 0x18, 0x39, 0xb7, 0xef, 0x96, 0xbc, 0x27, 0xc5, 0x82, 0xbc,
+    0x22, 0xfc, 0x9f, 0x3c, 0xba, 0x07, 0x45, 0xbc, 0xf7, 0x64, 0xb9, 0xbb,
+    0xc0, 0xc7, 0x17, 0x3c, 0xc7, 0xb9, 0x5d, 0x3c, 0xd2, 0x20, 0x89, 0x3c,
+    0x59, 0xa5, 0x58, 0xbc, 0x8f, 0x48, 0xe2, 0x3b, 0xf5, 0xe0, 0x98, 0x3c,
+    0x60, 0xd1, 0x90, 0xbc, 0x82, 0xf3, 0xe6, 0x3b, 0xa1, 0x60, 0x62, 0x3c,
+    0x22, 0xaf, 0xce, 0xbb, 0xb9, 0x63, 0x23, 0xbc, 0x9b, 0xbb, 0x7d, 0x3b,
+    0x66, 0x38, 0x17, 0xbb, 0x3d, 0x1c, 0x55, 0xbc, 0xb9, 0xc3, 0x94, 0xba,
+    0x77, 0x2d, 0x6c, 0xbb, 0xc6, 0x2c, 0x35, 0x3b, 0x99, 0x5b, 0xb4, 0x39,
+    0x39, 0x24, 0xf7, 0xbb, 0xf1, 0x3b, 0xbb, 0xbb, 0x25, 0x4a, 0x5d, 0x3c,
+    0x91, 0x3a, 0x23, 0xbc, 0x1e, 0xdc, 0x1e, 0x3b, 0xce, 0xc3, 0x9f, 0xbc,
+    0x75, 0x51, 0x1e, 0x3c, 0x45, 0x11, 0xd7, 0xbb, 0xbe, 0xdd, 0x94, 0xbc,
+    0xb4, 0x99, 0x0f, 0xbc, 0xe2, 0x4e, 0x2a, 0xbc, 0x3e, 0x7b, 0x94, 0x3c,
+    0xe0, 0xb0, 0xc1, 0xbb, 0x2e, 0x04, 0x0b, 0xbc, 0x3d, 0x8c, 0xb8, 0xbb,
+    0x2e, 0x71, 0x92, 0x3c, 0x55, 0x4e, 0xaf, 0x3b, 0xa6, 0xb2, 0x9e, 0x3b,
+    0xed, 0x4e, 0x0d, 0x3c, 0x2e, 0xc7, 0x92, 0xbb, 0x1e, 0x59, 0x60, 0xbb,
+    0x1c, 0xb3, 0xc5, 0x3b, 0x2e, 0x57, 0xa3, 0xbc, 0xe5, 0xa5, 0x49, 0xbc,
+    0x92, 0x0d, 0xd9, 0xbb, 0xbf, 0xc6, 0x2a, 0xbc, 0x97, 0x17, 0xb4, 0x3b,
+    0xf3, 0x0e, 0x9f, 0xbb, 0x98, 0x09, 0x76, 0x3c, 0xa5, 0xa7, 0x32, 0x3b,
+    0xe5, 0x60, 0x60, 0xbb, 0xba, 0x19, 0x80, 0xbb, 0x64, 0x45, 0x04, 0x3c,
+    0x3b, 0x5d, 0x56, 0xbb, 0xe9, 0x97, 0xd4, 0x3b, 0xe0, 0x82, 0x94, 0xbc,
+    0x86, 0x41, 0x0f, 0xbb, 0x05, 0xcb, 0x1d, 0xbc, 0xaa, 0x56, 0x60, 0xbc,
+    0x07, 0x90, 0x90, 0x3a, 0xa4, 0x87, 0x05, 0xba, 0x26, 0xf8, 0x20, 0x3b,
+    0x3b, 0x6f, 0x27, 0x3c, 0x90, 0x93, 0x7b, 0x3c, 0x22, 0x38, 0x63, 0xb9,
+    0xca, 0x56, 0xf6, 0xbb, 0x7d, 0x94, 0xad, 0xba, 0x4b, 0x89, 0x4a, 0x3c,
+    0x4d, 0xc5, 0x75, 0x3c, 0x87, 0xbe, 0x4c, 0x3c, 0xb2, 0x78, 0x4c, 0xbc,
+    0x6b, 0xa6, 0xa3, 0x3c, 0x2d, 0x71, 0xae, 0x3b, 0x51, 0x7d, 0x88, 0xbc,
+    0xbe, 0xd1, 0x13, 0x3c, 0x8c, 0x85, 0x9f, 0x3c, 0xcf, 0xb0, 0x80, 0xbb,
+    0xb2, 0xfb, 0xe9, 0x3b, 0xb8, 0xf0, 0xf0, 0xbb, 0x96, 0xbe, 0x3b, 0xbc,
+    0xf1, 0x6c, 0x0e, 0x3c, 0x46, 0x11, 0xa3, 0xbc, 0x59, 0x81, 0x53, 0x3c,
+    0x53, 0x9d, 0x94, 0x3a, 0x4b, 0xcc, 0x83, 0xbc, 0x51, 0xc1, 0x79, 0xbc,
+    0x2a, 0xa5, 0xc3, 0x3b, 0xb6, 0xe0, 0x74, 0x3c, 0xc5, 0x30, 0x10, 0xbc,
+    0xc3, 0xcc, 0x9c, 0x3c, 0x46, 0x03, 0x83, 0xbc, 0xf6, 0xf4, 0x67, 0x3c,
+    0x03, 0x67, 0x87, 0xbb, 0x4b, 0x2f, 0x89, 0xbc, 0xbf, 0xa4, 0x13, 0xbc,
+    0x9d, 0x87, 0xf6, 0xba, 0xc5, 0x96, 0x3f, 0x3c, 0x22, 0xd2, 0x6c, 0x3c,
+    0xd3, 0x3d, 0x70, 0xbc, 0x7a, 0xca, 0x5a, 0x3a, 0x76, 0xa2, 0xc5, 0x3b,
+    0x7e, 0x78, 0xc8, 0xbb, 0x66, 0xb4, 0x73, 0x3c, 0xaa, 0x38, 0x11, 0xbc,
+    0xea, 0xc0, 0x9d, 0xbc, 0xf5, 0x83, 0x96, 0xbc, 0x70, 0x3c, 0xed, 0x3b,
+    0xdf, 0xf9, 0x18, 0x3b, 0x59, 0x4f, 0x92, 0x3c, 0xea, 0xaa, 0x8f, 0x3c,
+    0xcf, 0x4c, 0x86, 0x3c, 0x72, 0x13, 0x96, 0xbc, 0xe3, 0x45, 0x23, 0x3c,
+    0xb3, 0xf0, 0x03, 0x3c, 0xcb, 0xa2, 0xcb, 0x3b, 0xb4, 0x2b, 0x0b, 0x3c,
+    0xc7, 0xf5, 0x83, 0x3c, 0x95, 0xaf, 0xb7, 0x3b, 0xed, 0x2e, 0xa7, 0xbb,
+    0x27, 0xdb, 0xc6, 0x3a, 0xa0, 0x77, 0x3f, 0xbc, 0xf0, 0x64, 0x64, 0x3b,
+    0xb3, 0xec, 0xa0, 0xbc, 0x99, 0xb4, 0x64, 0xbc, 0xdf, 0x5a, 0xda, 0xbb,
+    0xb4, 0xce, 0x3d, 0x3c, 0x1f, 0x32, 0x0f, 0x3c, 0x4a, 0x00, 0xd4, 0xbb,
+    0xe1, 0xfd, 0x9d, 0x3b, 0xb0, 0x56, 0x96, 0xbc, 0xd8, 0x4a, 0x5c, 0xbc,
+    0xe2, 0xe9, 0x9d, 0x3c, 0xdd, 0xee, 0x09, 0xbc, 0xf4, 0xe5, 0x89, 0xbb,
+    0x85, 0x32, 0xfe, 0x3a, 0x8e, 0x64, 0x07, 0xbc, 0x35, 0x02, 0x66, 0xba,
+    0x13, 0x96, 0x2a, 0xbc, 0x01, 0x07, 0x94, 0xbc, 0x68, 0xfc, 0x51, 0xbc,
+    0xff, 0xb2, 0x71, 0x3a, 0xa1, 0x9e, 0x8c, 0xbc, 0x16, 0xd6, 0x7d, 0xbb,
+    0xe7, 0xc2, 0xe0, 0xbb, 0x5c, 0x8d, 0x5f, 0xbb, 0xbc, 0x44, 0x83, 0xbc,
+    0xae, 0xe8, 0x85, 0x3c, 0x5e, 0x4a, 0x88, 0xba, 0xdc, 0x60, 0x5f, 0x3c,
+    0x06, 0x0d, 0x9c, 0x3c, 0xd2, 0xed, 0xcc, 0xbb, 0x33, 0x4b, 0x5b, 0xba,
+    0x88, 0xce, 0x02, 0x3c, 0x4f, 0x95, 0x40, 0xbb, 0x24, 0xd3, 0x01, 0xbc,
+    0xae, 0xd8, 0x19, 0x3c, 0xa7, 0x3c, 0x81, 0x3c, 0x0d, 0x86, 0x89, 0x3c,
+    0x93, 0x1f, 0xa6, 0x3b, 0x54, 0x17, 0xa3, 0xbb, 0x06, 0x81, 0x9b, 0x3c,
+    0xe6, 0x07, 0xb6, 0x3b, 0x6d, 0x44, 0x8e, 0xbc, 0x71, 0x18, 0x88, 0xbc,
+    0x28, 0xc1, 0x23, 0x3c, 0xe4, 0xcc, 0x8f, 0xbc, 0x73, 0x44, 0xa1, 0xbc,
+    0x23, 0x30, 0x8b, 0xbb, 0xbf, 0x44, 0x47, 0x3a, 0x58, 0xe3, 0x06, 0xbb,
+    0x54, 0xae, 0xee, 0xb9, 0xd8, 0x87, 0x5e, 0x3b, 0xf5, 0x03, 0xeb, 0x3b,
+    0x46, 0xc0, 0x49, 0xbb, 0xa2, 0x94, 0xac, 0xbb, 0xea, 0x0e, 0xa0, 0x3c,
+    0x8d, 0xaf, 0x1c, 0xbc, 0xb1, 0x99, 0x35, 0x3c, 0xca, 0x4c, 0x34, 0xbb,
+    0xaf, 0x70, 0xb9, 0xbb, 0x3f, 0xea, 0x8e, 0xbc, 0x6d, 0x46, 0x6e, 0x3c,
+    0xac, 0x62, 0x04, 0x3c, 0xfd, 0x0e, 0x84, 0x3c, 0x8d, 0xb1, 0xfd, 0xba,
+    0xd3, 0xe4, 0xe7, 0x3b, 0x3f, 0xc0, 0x79, 0xbc, 0x17, 0xc1, 0x85, 0xbb,
+    0x53, 0xde, 0x3f, 0xbc, 0x51, 0x0b, 0x96, 0xbc, 0xb9, 0xc9, 0x92, 0x3c,
+    0x04, 0x31, 0x3a, 0xbc, 0xdf, 0xc3, 0x67, 0xbc, 0x38, 0xf0, 0x45, 0xbc,
+    0xae, 0xdd, 0x9f, 0xbb, 0x4c, 0x39, 0xf3, 0x3a, 0x63, 0x80, 0x64, 0xbc,
+    0x47, 0x22, 0xa0, 0x3c, 0x12, 0x44, 0x9e, 0x3c, 0x5a, 0x6c, 0x66, 0xbc,
+    0xd2, 0xa8, 0x76, 0xbb, 0x51, 0xd6, 0xeb, 0x3b, 0x43, 0x80, 0x77, 0x3c,
+    0x81, 0xb0, 0x40, 0xb9, 0x69, 0xa8, 0x88, 0x3c, 0x6f, 0xb4, 0xe8, 0xbb,
+    0x9a, 0xc9, 0x82, 0xb8, 0x70, 0x10, 0x63, 0xb8, 0x67, 0xe9, 0xde, 0x3b,
+    0x90, 0x4d, 0x43, 0xbc, 0xe8, 0xe0, 0x8f, 0x3b, 0x0c, 0x4e, 0x38, 0xbc,
+    0x2a, 0x6d, 0xd1, 0xbb, 0xe3, 0x92, 0x97, 0x3c, 0x38, 0xbf, 0x82, 0x3c,
+    0x68, 0x7b, 0x50, 0x3c, 0xbf, 0x37, 0x98, 0xbc, 0x3f, 0x72, 0x66, 0xbc,
+    0x72, 0x54, 0x1f, 0xbc, 0x3d, 0x3b, 0x3a, 0x3c, 0x00, 0x5a, 0x60, 0x3c,
+    0x95, 0x71, 0x59, 0x3b, 0x6b, 0xf4, 0x0e, 0x3c, 0x58, 0x3b, 0x49, 0x3c,
+    0x6f, 0x18, 0x8e, 0xbc, 0xa9, 0x1a, 0x88, 0xbc, 0x5d, 0xc2, 0x71, 0x3c,
+    0x9a, 0xec, 0x96, 0xbc, 0x23, 0x2a, 0x34, 0xbc, 0x94, 0x86, 0x96, 0xbc,
+    0xd4, 0xd4, 0x9e, 0xbc, 0x05, 0x6a, 0x61, 0x3c, 0x19, 0x0b, 0xde, 0xbb,
+    0xc3, 0x5e, 0x5e, 0xbc, 0x50, 0x26, 0x66, 0xbc, 0xfc, 0x94, 0xcc, 0x3b,
+    0xdf, 0x8c, 0x99, 0x3c, 0xca, 0xb3, 0x51, 0x39, 0xe8, 0x6d, 0x83, 0x3c,
+    0xc4, 0xb9, 0xcb, 0x38, 0xfb, 0xa6, 0x41, 0x3b, 0x9b, 0x0e, 0xea, 0x3b,
+    0xf6, 0xf4, 0x47, 0x3c, 0x72, 0xfb, 0x28, 0x3c, 0xdb, 0xbc, 0xa0, 0x3c,
+    0xeb, 0xd9, 0x21, 0x3c, 0x5b, 0xf7, 0x84, 0x3c, 0x6d, 0x9b, 0x40, 0xbc,
+    0xf6, 0xae, 0xb9, 0x3a, 0x75, 0x41, 0x81, 0x3b, 0xd3, 0x72, 0x55, 0x3c,
+    0x1a, 0x81, 0x3a, 0xba, 0x72, 0xbc, 0x3e, 0x3c, 0x13, 0x0e, 0x92, 0xbb,
+    0x50, 0x76, 0x62, 0x3b, 0x25, 0x3d, 0x66, 0x3c, 0x15, 0x56, 0x43, 0x3c,
+    0x46, 0xc3, 0xcd, 0x3b, 0xd9, 0xc2, 0xa3, 0xbc, 0xc3, 0x6c, 0x50, 0xbc,
+    0x76, 0xd1, 0x8f, 0x39, 0xe1, 0xea, 0x20, 0xbc, 0x5d, 0x56, 0x8e, 0xbc,
+    0x6b, 0xda, 0x6b, 0x3c, 0x17, 0x25, 0x91, 0x3c, 0xda, 0x3b, 0x01, 0xbc,
+    0x0e, 0xfb, 0x70, 0xbb, 0xab, 0x2f, 0x4b, 0x3c, 0x66, 0x70, 0x8f, 0xbc,
+    0xab, 0xca, 0xb8, 0x3b, 0x31, 0x3d, 0x74, 0xbc, 0xa6, 0x88, 0x0b, 0xbc,
+    0xdd, 0x3a, 0x58, 0x3c, 0x18, 0xa5, 0x91, 0xbc, 0xb1, 0x10, 0x98, 0xbc,
+    0x2a, 0x4f, 0x57, 0xbb, 0x34, 0x51, 0xab, 0xb9, 0xda, 0x1b, 0x6e, 0x3c,
+    0x3a, 0x56, 0x0e, 0x3c, 0xa4, 0x77, 0xe3, 0x3b, 0xc6, 0x79, 0x64, 0xbc,
+    0xda, 0x7b, 0x9f, 0x3c, 0xce, 0xf0, 0x68, 0xbb, 0x14, 0x80, 0x92, 0x3b,
+    0xe0, 0x86, 0x94, 0xbb, 0xa2, 0x6d, 0x94, 0xbc, 0xd8, 0x9f, 0x98, 0xba,
+    0xc9, 0x7a, 0x64, 0xbc, 0xa4, 0x33, 0x99, 0xbc, 0x0c, 0xe1, 0x99, 0x3b,
+    0x73, 0x59, 0xaa, 0x3b, 0x70, 0x56, 0x81, 0xbc, 0xd3, 0xd3, 0x00, 0x3b,
+    0xb1, 0xf9, 0xc8, 0xbb, 0xbf, 0xcf, 0x98, 0xbb, 0x90, 0x27, 0x35, 0x3c,
+    0xd6, 0x02, 0xcb, 0xb9, 0x9a, 0xdf, 0x79, 0x3c, 0x0e, 0x56, 0x90, 0x3b,
+    0xf7, 0x06, 0xac, 0xba, 0xc1, 0x6c, 0xad, 0x3b, 0x5a, 0x83, 0xd4, 0xbb,
+    0x02, 0x34, 0x76, 0xbc, 0xc7, 0x3e, 0xef, 0x3b, 0xf9, 0xf4, 0x9f, 0x3b,
+    0x6c, 0x1d, 0x3d, 0x3c, 0xb5, 0x60, 0x74, 0xbc, 0xe3, 0xee, 0x86, 0x3c,
+    0x1f, 0x2d, 0x44, 0x3c, 0x0d, 0x9b, 0x88, 0x3c, 0xf4, 0x24, 0x74, 0x3c,
+    0xaf, 0x3f, 0xed, 0x3b, 0x75, 0x53, 0x4b, 0x3c, 0x5b, 0x4e, 0x47, 0x3a,
+    0x22, 0x19, 0x3b, 0x3c, 0xc2, 0xbb, 0x4b, 0xbc, 0xe5, 0xe2, 0x38, 0x3c,
+    0x00, 0x48, 0x11, 0xbb, 0x0f, 0x2d, 0x28, 0x3c, 0xd6, 0x76, 0xe9, 0xba,
+    0xe5, 0xc3, 0x3d, 0x3c, 0x19, 0x27, 0x8b, 0xbc, 0x4a, 0x36, 0x95, 0xbc,
+    0xda, 0x4e, 0x8e, 0x3c, 0xc6, 0x11, 0x11, 0xba, 0x4f, 0x6c, 0x83, 0x3c,
+    0x20, 0xbf, 0x91, 0x3c, 0xdf, 0x3f, 0xda, 0x3b, 0x09, 0x36, 0x3c, 0x3b,
+    0xc1, 0x22, 0x3a, 0xbc, 0xb0, 0x35, 0x85, 0xbc, 0x75, 0x51, 0x51, 0x3c,
+    0x21, 0xc9, 0x7e, 0x3c, 0xd2, 0x1a, 0x37, 0x3c, 0x2f, 0x17, 0x02, 0x3c,
+    0x86, 0x6c, 0x51, 0xbb, 0x97, 0x2e, 0xff, 0xbb, 0x2f, 0x55, 0x7d, 0xbc,
+    0x87, 0x10, 0x42, 0xbb, 0x8f, 0x0c, 0x2d, 0x3b, 0xcb, 0x91, 0x8a, 0x3c,
+    0xc2, 0xc9, 0x8e, 0x3c, 0x3c, 0x24, 0x5d, 0xbb, 0x9e, 0x54, 0x83, 0xbc,
+    0x29, 0x73, 0x33, 0x3c, 0x8d, 0x89, 0x19, 0x3c, 0xab, 0xc7, 0x99, 0xbc,
+    0x8b, 0xac, 0x0b, 0xbb, 0x89, 0x57, 0xf4, 0x3b, 0x32, 0xf7, 0x99, 0xbc,
+    0xf4, 0x63, 0x89, 0x3c, 0xb6, 0x77, 0x97, 0x3c, 0x7b, 0xd8, 0x11, 0x3c,
+    0xc0, 0x1a, 0x8a, 0xbc, 0x60, 0xcb, 0x8c, 0xbc, 0xc0, 0x7a, 0xb8, 0xbb,
+    0xad, 0x36, 0x9a, 0xbc, 0xc4, 0x63, 0xc7, 0xbb, 0x2e, 0x93, 0xa0, 0xbc,
+    0x24, 0x6d, 0x9b, 0x3c, 0x71, 0x10, 0x51, 0x3c, 0x98, 0xbb, 0x8c, 0xbc,
+    0xba, 0xeb, 0x80, 0x3c, 0x28, 0x61, 0x3f, 0xbc, 0xe3, 0x77, 0x41, 0xbc,
+    0xe5, 0xbf, 0xe3, 0x3b, 0x1b, 0x9c, 0x8f, 0x3c, 0x8b, 0xf2, 0x76, 0xbc,
+    0x5b, 0x7c, 0xa1, 0xbc, 0xa3, 0x88, 0xab, 0xbb, 0x3f, 0xc3, 0x9b, 0xbc,
+    0x3b, 0x6d, 0x89, 0x3b, 0xab, 0x63, 0x6b, 0x3c, 0x14, 0x22, 0x4d, 0xbc,
+    0xfe, 0x05, 0x7e, 0xbc, 0x0d, 0xe2, 0xcb, 0xbb, 0x19, 0x76, 0x96, 0x3c,
+    0x3e, 0x61, 0x72, 0xbc, 0x79, 0xde, 0x98, 0x3c, 0xa1, 0x90, 0xb4, 0xbb,
+    0xa4, 0x9d, 0x8b, 0xba, 0x94, 0xe6, 0x07, 0xbc, 0xdc, 0x3c, 0x8f, 0x3c,
+    0x3b, 0x20, 0x96, 0x3c, 0xbe, 0x25, 0xb2, 0x3b, 0x5c, 0x10, 0x4f, 0xbc,
+    0xcb, 0x87, 0xa1, 0x3c, 0xf8, 0x39, 0x82, 0xbc, 0x1a, 0xf1, 0x53, 0x3b,
+    0x00, 0x2e, 0x61, 0xbc, 0x6c, 0x4f, 0x82, 0x3c, 0x37, 0x0a, 0x92, 0x3c,
+    0x38, 0x7c, 0x47, 0x3c, 0x97, 0x50, 0xf1, 0xbb, 0x82, 0x88, 0x28, 0xbc,
+    0x25, 0x06, 0x27, 0x3c, 0x65, 0xee, 0x08, 0xbc, 0x1f, 0x47, 0x52, 0xbb,
+    0xd5, 0xae, 0x94, 0xbc, 0xee, 0x04, 0x71, 0xbc, 0x36, 0x1b, 0x9d, 0xbc,
+    0x8b, 0x4e, 0x8a, 0xbc, 0xa5, 0xd9, 0x8b, 0xbc, 0x99, 0x1b, 0x51, 0xbb,
+    0xfd, 0x1b, 0x05, 0x3b, 0xc3, 0xdc, 0x1d, 0x3c, 0xe0, 0x6e, 0x6a, 0xbc,
+    0x40, 0xfa, 0x4b, 0xbb, 0x2d, 0x86, 0xb3, 0x3b, 0xff, 0x21, 0x88, 0xbc,
+    0x9b, 0xac, 0x10, 0xbb, 0x65, 0x5e, 0xab, 0xbb, 0x24, 0x1b, 0x93, 0x3c,
+    0xa2, 0xe1, 0x90, 0xbc, 0xe8, 0x87, 0x6f, 0xbb, 0x0a, 0xfd, 0x58, 0xbb,
+    0x56, 0x8a, 0x15, 0x3c, 0xd4, 0x0c, 0xeb, 0xbb, 0x31, 0xfe, 0x41, 0xbc,
+    0x8d, 0x74, 0x07, 0xbc, 0x14, 0xa2, 0x98, 0xba, 0x3f, 0x8b, 0x93, 0x3c,
+    0x4d, 0x53, 0x42, 0x3c, 0x2f, 0x2a, 0x12, 0xbc, 0x01, 0x85, 0x18, 0x3b,
+    0x8b, 0xad, 0xf6, 0x3b, 0x0a, 0xc3, 0x41, 0x3c, 0x78, 0x20, 0x0d, 0xbb,
+    0xd6, 0xac, 0x84, 0xbb, 0xaa, 0x66, 0x2f, 0x3c, 0x49, 0x00, 0x33, 0xbb,
+    0xb0, 0x2d, 0x25, 0xbc, 0x56, 0x12, 0xf4, 0xba, 0xff, 0x3a, 0x8f, 0x3c,
+    0x39, 0x3f, 0x6a, 0xbc, 0x6a, 0xf2, 0xc4, 0xba, 0x6b, 0xf7, 0xb3, 0x3b,
+    0xf7, 0x3c, 0x2f, 0xba, 0xf9, 0x38, 0x42, 0xbc, 0x6d, 0x3c, 0xa3, 0xbc,
+    0x45, 0x69, 0x02, 0x3c, 0x07, 0xa1, 0x9b, 0x3b, 0xb0, 0x4a, 0xa1, 0xbc,
+    0x01, 0x04, 0x04, 0xbc, 0x5a, 0x0d, 0x30, 0x3c, 0x80, 0xfa, 0xa8, 0x3b,
+    0x4e, 0x05, 0xed, 0x3a, 0x87, 0x4c, 0x61, 0xbc, 0x66, 0x32, 0x07, 0x3c,
+    0x66, 0xc3, 0x95, 0xba, 0xde, 0x8a, 0xe9, 0x3b, 0xd5, 0x73, 0x2a, 0x3c,
+    0x16, 0x66, 0x2f, 0xbc, 0x78, 0xb3, 0x2b, 0x3c, 0x0c, 0x1f, 0x10, 0xbc,
+    0x22, 0x9a, 0x9e, 0x3c, 0xe6, 0x7d, 0x78, 0xbc, 0x33, 0x79, 0x7b, 0x3c,
+    0xb3, 0x8d, 0x96, 0xbc, 0xcd, 0x87, 0x1f, 0xbc, 0x64, 0xd9, 0x88, 0x3a,
+    0xb2, 0xf3, 0x55, 0x3b, 0xc3, 0x01, 0x88, 0xbb, 0x00, 0x68, 0x82, 0xbc,
+    0x7a, 0x21, 0x22, 0xbc, 0x09, 0xf4, 0x0d, 0xbc, 0x4a, 0x43, 0x27, 0x3c,
+    0x7a, 0xf2, 0x85, 0x3c, 0x83, 0x1c, 0x7a, 0x3b, 0x33, 0x39, 0x98, 0xbc,
+    0x25, 0x85, 0x3f, 0x3c, 0x7f, 0xcc, 0xfe, 0xbb, 0xdd, 0xdb, 0xd1, 0xbb,
+    0x35, 0x42, 0x9e, 0x3a, 0xeb, 0x76, 0x24, 0xbc, 0x51, 0x9e, 0x89, 0x3c,
+    0x25, 0x7e, 0x5c, 0xbc, 0x5a, 0x44, 0x5f, 0xbb, 0xd6, 0xd3, 0x09, 0xbc,
+    0xc3, 0xf9, 0x4f, 0x3a, 0x59, 0xf0, 0x41, 0x3b, 0x00, 0xa5, 0xa6, 0x3b,
+    0xe4, 0x7f, 0xa4, 0x3a, 0x16, 0xd2, 0x69, 0xbb, 0x42, 0x6a, 0xb0, 0x3b,
+    0x85, 0x32, 0x7d, 0xbb, 0xfb, 0x8c, 0x36, 0x3c, 0x26, 0xdc, 0x3c, 0x3c,
+    0xf8, 0x25, 0x08, 0xbc, 0x55, 0x07, 0xa8, 0xbb, 0xc5, 0xd5, 0xa8, 0x3b,
+    0x1d, 0xbe, 0x60, 0xbc, 0x79, 0x20, 0x01, 0x3c, 0x3e, 0x6a, 0x9b, 0xbb,
+    0xfe, 0xb6, 0x6e, 0x3b, 0x50, 0x3c, 0x6c, 0xbc, 0x25, 0x8a, 0xdc, 0x3b,
+    0x0e, 0x4a, 0xbf, 0xbb, 0xa4, 0x4f, 0x8f, 0xba, 0x75, 0x8a, 0x5e, 0xbb,
+    0x88, 0x28, 0x74, 0xba, 0x04, 0x31, 0xff, 0x3b, 0x7a, 0x3c, 0xee, 0xbb,
+    0x04, 0x4d, 0xc7, 0x3b, 0x3e, 0x1b, 0x90, 0xbc, 0x5e, 0xf3, 0x02, 0xbc,
+    0x5c, 0xb3, 0x20, 0x3c, 0xeb, 0xaa, 0x92, 0xbc, 0x93, 0xc8, 0x9e, 0x3b,
+    0x05, 0x78, 0x9b, 0xbc, 0x4e, 0x45, 0x95, 0xba, 0x0b, 0xa3, 0x7e, 0x3c,
+    0xf2, 0x86, 0xa0, 0xbc, 0xf6, 0xa7, 0x8c, 0x3a, 0x3d, 0x10, 0x8e, 0xbc,
+    0xcd, 0x96, 0x70, 0x3c, 0xbd, 0x2e, 0xf4, 0x3b, 0x1f, 0x91, 0x1e, 0x3c,
+    0x89, 0x85, 0xdd, 0x3b, 0x34, 0xbc, 0xa1, 0xbc, 0xca, 0x58, 0x96, 0xbc,
+    0x86, 0x6f, 0x9e, 0x3b, 0xa0, 0xbc, 0xa3, 0x3c, 0xb8, 0x8b, 0x74, 0x3c,
+    0xb8, 0xdd, 0x02, 0x3c, 0x0d, 0xd5, 0x14, 0x3c, 0x4f, 0x1e, 0x33, 0xbc,
+    0xd0, 0xe5, 0x24, 0x3c, 0x6e, 0xfc, 0x0a, 0xbc, 0x64, 0x48, 0x81, 0xbc,
+    0xfc, 0x05, 0xcd, 0xba, 0xd8, 0x90, 0xde, 0xbb, 0x82, 0x69, 0x59, 0xbc,
+    0x9a, 0x3b, 0x4d, 0xbb, 0xa2, 0x27, 0x82, 0x3c, 0x62, 0xaf, 0x29, 0xbb,
+    0xcf, 0x2b, 0x0a, 0xbb, 0x7c, 0xdb, 0x08, 0x3c, 0x07, 0x5b, 0x7d, 0x3a,
+    0x0d, 0xfe, 0x72, 0xbc, 0x36, 0x7a, 0x86, 0x3c, 0x86, 0x79, 0x12, 0xbb,
+    0xd1, 0x9e, 0x3d, 0x3c, 0x52, 0xa7, 0x91, 0xbb, 0x38, 0x18, 0x49, 0x3c,
+    0x6e, 0xc9, 0x90, 0xbb, 0x71, 0x65, 0x37, 0xbc, 0x14, 0x1a, 0x47, 0xbc,
+    0xc8, 0x30, 0x90, 0x3c, 0x79, 0xd5, 0x62, 0x3b, 0x14, 0x86, 0x93, 0xbc,
+    0x54, 0x58, 0x92, 0xbb, 0x7c, 0x4e, 0x2e, 0xbc, 0x7e, 0x19, 0x88, 0xbc,
+    0xa5, 0x49, 0x4d, 0xbc, 0x55, 0x2a, 0x91, 0xbc, 0xd2, 0xf9, 0xb4, 0x3b,
+    0xc6, 0x0e, 0x56, 0xbc, 0x8f, 0x33, 0x91, 0x3b, 0x00, 0x77, 0x93, 0x3b,
+    0x7e, 0x4c, 0x06, 0x3c, 0x83, 0x25, 0xfe, 0x39, 0xa7, 0x47, 0x0d, 0xbc,
+    0xda, 0x5e, 0x77, 0x3c, 0x2a, 0x95, 0xc0, 0xbb, 0x69, 0xa8, 0xda, 0xba,
+    0x65, 0xdb, 0xac, 0x3b, 0x55, 0x13, 0x29, 0x3a, 0x57, 0x93, 0x95, 0x3c,
+    0x7c, 0x00, 0x95, 0x3c, 0xdf, 0xd2, 0x8c, 0x3c, 0xf7, 0x3c, 0x8e, 0x3c,
+    0x6d, 0x3b, 0x54, 0x3b, 0x45, 0x7a, 0xcd, 0xb9, 0x1f, 0xc5, 0x05, 0x3c,
+    0xab, 0x80, 0x3a, 0xbc, 0x27, 0x70, 0x19, 0xbc, 0x39, 0x7c, 0x95, 0xbc,
+    0x1e, 0xf3, 0x5c, 0xbc, 0x05, 0x92, 0xa2, 0xbc, 0x68, 0xac, 0xca, 0x3b,
+    0xb2, 0xa9, 0x6b, 0xbc, 0xd0, 0xe0, 0x3b, 0x3c, 0x17, 0x97, 0xec, 0x3b,
+    0x26, 0x3b, 0x9a, 0x3c, 0xfa, 0xa3, 0x87, 0xbb, 0xea, 0x14, 0x8a, 0x3c,
+    0x35, 0xb9, 0xf2, 0xba, 0x9c, 0x5d, 0xd2, 0xbb, 0x3c, 0x4e, 0x82, 0xbc,
+    0x95, 0xe4, 0x7a, 0x3c, 0x95, 0x31, 0x41, 0x3c, 0x2d, 0x17, 0xe8, 0xbb,
+    0xe2, 0x06, 0xe8, 0xba, 0x1e, 0x30, 0xe5, 0xbb, 0xae, 0x64, 0x9a, 0xbc,
+    0x7b, 0x4e, 0x95, 0xbc, 0x96, 0x17, 0xac, 0xbb, 0x7d, 0x52, 0x3e, 0xbc,
+    0xf2, 0x86, 0x80, 0x3a, 0xfb, 0x9c, 0x4c, 0xbc, 0x97, 0x8b, 0x43, 0xbc,
+    0xba, 0x51, 0xe2, 0x3b, 0x91, 0x67, 0x1a, 0x3c, 0x74, 0x1c, 0xf6, 0xbb,
+    0x0a, 0xed, 0x6b, 0x3c, 0xb7, 0xcc, 0x20, 0xbc, 0xec, 0x8c, 0xcc, 0xbb,
+    0x4b, 0x40, 0x0b, 0x3c, 0xde, 0x41, 0x95, 0xbc, 0xf3, 0x45, 0x8e, 0x3c,
+    0xe9, 0x22, 0x8c, 0xbc, 0x72, 0xd5, 0xcc, 0xba, 0x70, 0x32, 0x13, 0x3c,
+    0x17, 0x49, 0x94, 0xbc, 0x0c, 0x82, 0x4a, 0x3c, 0x7c, 0xec, 0x9c, 0x3c,
+    0x56, 0x08, 0xcf, 0xba, 0x39, 0x44, 0x7a, 0xbc, 0x41, 0x24, 0x89, 0xbc,
+    0xee, 0x7c, 0x83, 0xbc, 0xac, 0xf5, 0x2d, 0x3c, 0x00, 0x69, 0x61, 0xbb,
+    0xe9, 0x5f, 0x89, 0x3c, 0xf9, 0x9b, 0x1b, 0xbb, 0xca, 0x8f, 0x8a, 0xbc,
+    0xb2, 0x88, 0x3f, 0xbb, 0x07, 0x01, 0x27, 0x3c, 0xd2, 0xd5, 0x57, 0x3c,
+    0xfb, 0xf1, 0x96, 0xbc, 0xc3, 0x75, 0x51, 0xbc, 0xdf, 0x6e, 0xd1, 0xb9,
+    0xe7, 0xbc, 0x73, 0xbc, 0x04, 0x33, 0x73, 0x3c, 0x39, 0x5d, 0x8e, 0x3c,
+    0x34, 0x75, 0xec, 0xbb, 0xaa, 0xcd, 0x2a, 0xbb, 0x56, 0x90, 0x15, 0x3b,
+    0x28, 0x92, 0x0c, 0xbc, 0xde, 0x5a, 0xd7, 0x3a, 0xd5, 0xd4, 0x43, 0xbc,
+    0xf0, 0x45, 0x05, 0xbc, 0x58, 0x9c, 0x18, 0xbb, 0x64, 0x31, 0x89, 0x3b,
+    0xe0, 0x9b, 0xbd, 0x3a, 0x90, 0xa3, 0x1c, 0xbc, 0x87, 0xc6, 0x2f, 0xbc,
+    0x74, 0xde, 0x79, 0xbc, 0x57, 0xca, 0x39, 0x3c, 0xa4, 0x6e, 0x83, 0xbc,
+    0x9f, 0x9f, 0x18, 0x3c, 0xc8, 0xa4, 0x24, 0xbc, 0x57, 0x31, 0x0d, 0xbc,
+    0x3a, 0xb8, 0x1a, 0x3c, 0xda, 0x37, 0xd1, 0x3b, 0xb4, 0x8b, 0x1e, 0x3c,
+    0x26, 0x41, 0x20, 0x3a, 0x48, 0x56, 0x6b, 0x3c, 0x75, 0xdc, 0x77, 0xbc,
+    0x04, 0x50, 0xbe, 0x3b, 0xfa, 0x2f, 0x7a, 0xbc, 0x8b, 0x81, 0x1b, 0x3c,
+    0xbd, 0xef, 0xb8, 0xbb, 0xb2, 0x38, 0xe5, 0x3b, 0xf0, 0x5a, 0x05, 0x3c,
+    0x41, 0x83, 0xd2, 0x3b, 0xd2, 0x7a, 0x36, 0xbc, 0xc9, 0x72, 0x59, 0x3c,
+    0xee, 0x4d, 0x2a, 0xbc, 0xe3, 0x59, 0x3e, 0x3a, 0x64, 0xe9, 0xe4, 0x3b,
+    0xf9, 0x95, 0x2e, 0xbc, 0x61, 0x71, 0xa8, 0x3b, 0xd1, 0xb3, 0x0b, 0xbc,
+    0xe3, 0x5c, 0x57, 0xbc, 0x3b, 0xff, 0x4a, 0x3c, 0x16, 0x42, 0x0b, 0x3b,
+    0x4f, 0x98, 0xe1, 0xbb, 0xbd, 0xf3, 0x5f, 0x3b, 0xdd, 0x8d, 0x9b, 0xbc,
+    0x6b, 0x99, 0x72, 0xbc, 0x41, 0xdd, 0x88, 0xbb, 0x5b, 0xe5, 0x9b, 0x3c,
+    0xa4, 0xaa, 0xdb, 0x39, 0x6e, 0xc9, 0x8a, 0xbc, 0x70, 0xb2, 0x2d, 0x3c,
+    0x72, 0x72, 0x38, 0x3c, 0x28, 0x18, 0x34, 0x3c, 0x58, 0x2f, 0x36, 0x3b,
+    0xcd, 0x40, 0x00, 0x3c, 0xc8, 0xc9, 0x3b, 0xbc, 0x31, 0x69, 0x18, 0x3c,
+    0x31, 0x35, 0x4f, 0x3c, 0x26, 0x5f, 0x2a, 0x3c, 0xdc, 0x11, 0xc0, 0xbb,
+    0xe4, 0x9f, 0x6e, 0x3b, 0xa5, 0x11, 0xa9, 0x3b, 0x5e, 0x56, 0x83, 0x3c,
+    0x2e, 0x72, 0x80, 0xbc, 0xca, 0xd8, 0x5a, 0x3c, 0x35, 0x99, 0x8a, 0x3a,
+    0x3b, 0x51, 0xb9, 0xbb, 0xc7, 0xc4, 0xe8, 0xba, 0x19, 0xb3, 0x9f, 0xbc,
+    0xdc, 0x73, 0x37, 0xbc, 0xe6, 0x3a, 0xc8, 0x3b, 0x10, 0xd4, 0xd2, 0x3b,
+    0xb2, 0x57, 0x5e, 0xb9, 0xbb, 0x8b, 0x94, 0x3c, 0xab, 0x1e, 0x48, 0xba,
+    0x26, 0xde, 0xf3, 0xbb, 0xf1, 0xeb, 0x63, 0x3c, 0x88, 0xd6, 0x1d, 0xbc,
+    0x49, 0xb7, 0x88, 0x3b, 0x05, 0x50, 0x05, 0x3c, 0xaf, 0xd3, 0x52, 0x3c,
+    0xee, 0x04, 0x3b, 0x3c, 0x29, 0xec, 0x97, 0xbb, 0xa3, 0x72, 0x90, 0xbc,
+    0x39, 0x4b, 0x97, 0xbc, 0xc0, 0x69, 0x14, 0x3c, 0x7b, 0x49, 0x97, 0x3c,
+    0xf8, 0x90, 0xcd, 0xbb, 0x4d, 0x27, 0x1a, 0xbb, 0x9f, 0xfa, 0x13, 0x3c,
+    0x61, 0xdf, 0xce, 0x3b, 0x70, 0x37, 0x1d, 0xbc, 0x52, 0xe6, 0xe0, 0x3b,
+    0xe3, 0xb7, 0xff, 0xbb, 0x4a, 0x46, 0xbc, 0xbb, 0xdc, 0x29, 0xcf, 0x3a,
+    0xcb, 0x3f, 0x18, 0x3c, 0x36, 0x94, 0x64, 0xbc, 0x9e, 0xa2, 0x9c, 0xbc,
+    0x9d, 0x8c, 0xa7, 0x3b, 0x68, 0xca, 0x9b, 0xbc, 0x40, 0x1b, 0x95, 0xbc,
+    0x39, 0xb7, 0x33, 0xbc, 0x83, 0xb0, 0xc9, 0x3b, 0xd5, 0x08, 0x8e, 0xbc,
+    0x11, 0x64, 0x8f, 0xbc, 0x0d, 0xb2, 0x9a, 0x3c, 0xc4, 0xc2, 0x4a, 0xbb,
+    0x53, 0x97, 0x80, 0x3c, 0x55, 0xc7, 0x39, 0xbc, 0xb3, 0xd5, 0x29, 0xbb,
+    0x81, 0x13, 0xba, 0xbb, 0x39, 0xb9, 0x53, 0xbc, 0xc3, 0x60, 0xe0, 0xbb,
+    0x65, 0x83, 0x9f, 0x3c, 0x91, 0x13, 0x22, 0x3c, 0xfe, 0xc9, 0x99, 0xbb,
+    0x2f, 0xce, 0x6d, 0xbb, 0xb3, 0xd5, 0x1a, 0xbc, 0x61, 0x4b, 0xa4, 0x3a,
+    0x50, 0x6d, 0x1a, 0x3c, 0x36, 0xa4, 0xf4, 0x3b, 0x8b, 0xd2, 0xc3, 0xba,
+    0xf0, 0x18, 0x96, 0xbc, 0xa3, 0x1e, 0x8a, 0x3c, 0x7d, 0xb9, 0x6e, 0xbb,
+    0x98, 0xc9, 0x8f, 0xbb, 0x25, 0xd2, 0xa2, 0xbc, 0x67, 0x17, 0x6d, 0xbc,
+    0x56, 0xbb, 0x71, 0x3c, 0x66, 0x1d, 0x12, 0x3a, 0x19, 0x54, 0x18, 0x3c,
+    0xa2, 0x93, 0x66, 0xbc, 0x6b, 0xc1, 0xde, 0xbb, 0x72, 0xe9, 0x5e, 0x3c,
+    0x93, 0x25, 0x52, 0x3c, 0xdf, 0xf0, 0x25, 0xbc, 0x9e, 0xa3, 0x9c, 0xbc,
+    0xa0, 0xd8, 0x48, 0x3c, 0xc2, 0x06, 0x59, 0xbc, 0xee, 0x88, 0x3c, 0x3c,
+    0xd0, 0xb9, 0xf0, 0x3b, 0x8d, 0x5f, 0x59, 0xbc, 0xef, 0x1e, 0x8a, 0xbc,
+    0xd6, 0x21, 0x8c, 0x3c, 0x8a, 0x4a, 0x80, 0x3b, 0x81, 0xf4, 0x9d, 0x3b,
+    0xb1, 0xc2, 0xde, 0xba, 0x59, 0x54, 0x65, 0xbc, 0x6d, 0xa7, 0x85, 0x3b,
+    0x29, 0x38, 0x22, 0xbc, 0x9b, 0x78, 0x48, 0x3c, 0xc3, 0x83, 0x18, 0x3c,
+    0xb4, 0xe7, 0x9a, 0xbc, 0x45, 0xb2, 0x8d, 0x3c, 0xa1, 0xf0, 0x97, 0xbc,
+    0x3a, 0x79, 0x86, 0xbc, 0x5f, 0xd5, 0x07, 0xbc, 0x85, 0xd8, 0x64, 0xbc,
+    0x82, 0xeb, 0x2c, 0xbc, 0x4f, 0xfe, 0xbc, 0xbb, 0x4c, 0x56, 0x1a, 0x3c,
+    0x20, 0xcb, 0x79, 0xbb, 0x7b, 0xd6, 0x16, 0xbc, 0x71, 0x34, 0xa1, 0xb9,
+    0xba, 0xc7, 0x8c, 0xbb, 0x00, 0x09, 0xf8, 0xbb, 0xdf, 0x3f, 0x83, 0x3c,
+    0x62, 0x3f, 0x04, 0x3b, 0x22, 0x69, 0x9c, 0x3c, 0x1b, 0xdb, 0x32, 0x3c,
+    0x47, 0xcf, 0x38, 0x3b, 0xd9, 0xae, 0x1b, 0xbc, 0x54, 0xe6, 0xf4, 0x3b,
+    0x3c, 0x1e, 0xe7, 0xba, 0xb2, 0x16, 0x11, 0x3c, 0xf3, 0x3c, 0x7c, 0xbb,
+    0x99, 0x8f, 0x27, 0xb9, 0xf6, 0x0f, 0x9d, 0xbc, 0x5b, 0x42, 0x1d, 0x3c,
+    0xf7, 0x9b, 0x98, 0xbc, 0x60, 0xe1, 0xec, 0x3b, 0xc0, 0xf7, 0x56, 0x3b,
+    0x4b, 0xd3, 0x34, 0x3c, 0x77, 0xc5, 0x09, 0xbc, 0x6d, 0xf0, 0xf3, 0x3b,
+    0xce, 0xf4, 0x3f, 0xbc, 0x37, 0x78, 0x99, 0x3a, 0x03, 0x59, 0xd1, 0xbb,
+    0xad, 0xc7, 0x9c, 0x3c, 0x09, 0x9f, 0x9a, 0x3c, 0xc7, 0xba, 0x3e, 0xbc,
+    0x83, 0x1d, 0x2d, 0x3b, 0x8a, 0x8d, 0xdf, 0xbb, 0xd5, 0x87, 0x99, 0x3c,
+    0xd1, 0x1b, 0x8b, 0x3c, 0x81, 0xd3, 0x61, 0x3b, 0x0b, 0x3c, 0x10, 0x3c,
+    0x7e, 0xaa, 0xed, 0x3b, 0xaf, 0x35, 0xc0, 0xbb, 0xf1, 0x6e, 0x88, 0x3c,
+    0x97, 0xe4, 0x82, 0x3c, 0x97, 0xf5, 0xdd, 0xbb, 0xfb, 0x21, 0x22, 0x3c,
+    0x56, 0xdc, 0xa0, 0xbc, 0x40, 0x54, 0x4f, 0x3c, 0x15, 0x0d, 0x2a, 0x3b,
+    0x3d, 0x36, 0x94, 0x3c, 0xc9, 0x50, 0xb3, 0xbb, 0x4f, 0xc6, 0xa4, 0x3b,
+    0x87, 0xfe, 0xe7, 0xbb, 0x84, 0x53, 0x39, 0x3c, 0x52, 0xfe, 0x83, 0x3b,
+    0x09, 0xbc, 0x9f, 0x3c, 0x15, 0x82, 0xa3, 0xbc, 0xaf, 0x6e, 0x6b, 0xbc,
+    0x7e, 0x8d, 0x95, 0xbc, 0x51, 0x34, 0x75, 0xbc, 0x73, 0xb3, 0x8c, 0x3c,
+    0xfe, 0xff, 0x92, 0x3c, 0xb4, 0x63, 0x4d, 0xba, 0x06, 0x5f, 0x92, 0x3c,
+    0x94, 0xa8, 0x50, 0x3c, 0x4d, 0x98, 0x36, 0x3c, 0x07, 0x0f, 0x22, 0x3c,
+    0xdd, 0xb2, 0x4c, 0xbc, 0xfa, 0x20, 0x00, 0x3b, 0xc9, 0x8b, 0x47, 0xbb,
+    0xf5, 0x62, 0x93, 0x3c, 0xa7, 0xc1, 0x55, 0xbc, 0x7f, 0x5c, 0x58, 0xbc,
+    0x29, 0x39, 0xd0, 0x3b, 0x71, 0x86, 0x60, 0xbc, 0x23, 0x8e, 0x7f, 0xbc,
+    0x03, 0x8d, 0x24, 0x39, 0x74, 0x6b, 0x42, 0x3c, 0x7a, 0xaf, 0x89, 0x3b,
+    0xa0, 0xf4, 0x26, 0x3c, 0x32, 0x83, 0x19, 0xbc, 0x40, 0xed, 0x0c, 0xbc,
+    0x2d, 0xe6, 0x3a, 0xbb, 0x4e, 0xd7, 0xa0, 0x3c, 0x9e, 0xd0, 0x0e, 0x3c,
+    0x7f, 0x3a, 0x92, 0x3c, 0xde, 0x8c, 0xc6, 0x3a, 0x7f, 0x06, 0x0f, 0x3b,
+    0xc2, 0x97, 0xa0, 0x3c, 0x56, 0x2b, 0x4b, 0xbc, 0xcf, 0x32, 0x39, 0x3c,
+    0xe7, 0x0b, 0x3f, 0x3c, 0x0c, 0xee, 0x61, 0x3c, 0xe2, 0xdf, 0x23, 0x3c,
+    0x86, 0xe1, 0x61, 0xbc, 0x76, 0x31, 0xd3, 0x3b, 0xcd, 0xd6, 0x8a, 0x3c,
+    0xf2, 0xe5, 0x25, 0x3b, 0x49, 0x44, 0xb6, 0xbb, 0x7c, 0x4c, 0x93, 0x3c,
+    0x28, 0x7a, 0x21, 0x3b, 0xd0, 0xa3, 0x67, 0xbb, 0xd9, 0x98, 0x95, 0x3b,
+    0xb6, 0x4f, 0x47, 0x3c, 0x58, 0x0f, 0x32, 0xbc, 0xb2, 0xb2, 0x9e, 0xbc,
+    0x83, 0x8a, 0x98, 0x3a, 0xbe, 0x9f, 0x90, 0x3c, 0x89, 0x44, 0xec, 0x3b,
+    0x70, 0x95, 0xab, 0x3b, 0xa6, 0x87, 0xa7, 0x3b, 0x70, 0x85, 0xfc, 0xb8,
+    0xd3, 0x55, 0x17, 0x3c, 0x31, 0x5e, 0x24, 0xbc, 0xbb, 0x5e, 0x80, 0x3c,
+    0x36, 0xcd, 0x13, 0xbc, 0xb1, 0xcc, 0x91, 0x3c, 0x23, 0xc1, 0x8b, 0x3c,
+    0x42, 0x4e, 0x8a, 0xbc, 0x04, 0xd8, 0x07, 0xbb, 0x7f, 0xee, 0x1f, 0x3c,
+    0x95, 0xfa, 0x03, 0xbb, 0x47, 0xa0, 0xba, 0x39, 0x84, 0x14, 0x49, 0x3c,
+    0xfa, 0x57, 0x06, 0x3c, 0x2e, 0x14, 0x96, 0x3c, 0xe9, 0xe1, 0x5b, 0xbc,
+    0xba, 0xca, 0x8a, 0x3c, 0x17, 0x3e, 0x8c, 0x3c, 0x3e, 0x9e, 0xb0, 0x3b,
+    0xa9, 0x4e, 0x90, 0x3c, 0x79, 0x14, 0x22, 0xbc, 0x47, 0x35, 0x7a, 0x3c,
+    0x36, 0x3a, 0x33, 0x3c, 0x85, 0xc5, 0x8f, 0x3b, 0x82, 0x24, 0x86, 0xbc,
+    0x30, 0xf7, 0x99, 0xbc, 0xda, 0x3e, 0xa0, 0xbc, 0x6a, 0x79, 0x23, 0xbc,
+    0x6e, 0xef, 0x2b, 0x3c, 0x54, 0x9a, 0x94, 0xbb, 0x4b, 0x84, 0x34, 0x3c,
+    0xa0, 0xae, 0xa4, 0x3b, 0x8a, 0x25, 0x91, 0xbb, 0x05, 0x22, 0x79, 0x3c,
+    0x5e, 0x40, 0x97, 0xbc, 0x1e, 0xdc, 0xb5, 0xba, 0x0a, 0x2c, 0x58, 0x3c,
+    0x4f, 0x92, 0x74, 0xbc, 0xf4, 0xf1, 0x09, 0x3c, 0xc1, 0x4a, 0xe1, 0xbb,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0x9b, 0xbc,
+    0xcd, 0xc1, 0x89, 0xba, 0x01, 0x77, 0x63, 0x3a, 0x88, 0x36, 0x96, 0xbc,
+    0xbb, 0xcd, 0x2c, 0x3b, 0xb6, 0xf8, 0xc7, 0xbb, 0x1f, 0x5e, 0xa2, 0xbc,
+    0x9e, 0xa7, 0x4a, 0xbc, 0x22, 0x0f, 0x7f, 0xbc, 0xdd, 0xf9, 0xd4, 0x3a,
+    0xdc, 0xb5, 0x95, 0xbc, 0x5d, 0x4a, 0x8c, 0x3c, 0xcb, 0x23, 0x62, 0x3c,
+    0x46, 0xea, 0x91, 0x3c, 0x76, 0xbe, 0xf2, 0xbb, 0x4b, 0xcc, 0x84, 0x3c,
+    0x12, 0xb3, 0x9e, 0x3c, 0x91, 0x7e, 0x2d, 0x3c, 0xe0, 0x66, 0x13, 0xbc,
+    0xef, 0xfc, 0xdf, 0x3b, 0x75, 0xc6, 0x7a, 0x3b, 0x13, 0x20, 0x7b, 0xbb,
+    0xc4, 0x26, 0xfe, 0xbb, 0x9c, 0x3a, 0x90, 0xbc, 0x64, 0x82, 0x75, 0xbc,
+    0xf7, 0xe3, 0x6f, 0xbc, 0x53, 0x5a, 0x48, 0xba, 0x85, 0xfb, 0xb9, 0x3b,
+    0x56, 0x0f, 0x2d, 0x3c, 0x68, 0x88, 0x94, 0xbc, 0xe5, 0x2d, 0x54, 0x3c,
+    0x69, 0x98, 0x95, 0xbc, 0x32, 0x0a, 0x10, 0x3b, 0x36, 0x01, 0x20, 0x3c,
+    0x96, 0xfe, 0xab, 0x3b, 0xc8, 0x59, 0x93, 0x3c, 0x96, 0x8e, 0xcb, 0xbb,
+    0x58, 0x23, 0x61, 0x3b, 0x5a, 0xb5, 0x88, 0xbc, 0xd0, 0xc0, 0x1c, 0x3b,
+    0xd1, 0x52, 0x4d, 0x3c, 0x75, 0x8e, 0x43, 0xbc, 0x81, 0xa7, 0x1c, 0xbc,
+    0x7d, 0x56, 0x03, 0x3c, 0xc1, 0x4b, 0x21, 0xbc, 0xe8, 0xc7, 0x1d, 0xbc,
+    0xac, 0xb5, 0x8e, 0x3c, 0xd2, 0x5c, 0xa3, 0x3c, 0x1b, 0xf8, 0x61, 0xbc,
+    0x0e, 0x20, 0x83, 0x3c, 0x25, 0x38, 0x0a, 0x3b, 0xf1, 0x30, 0x97, 0xbc,
+    0xe7, 0x23, 0x60, 0x3b, 0x2e, 0x88, 0xb9, 0x3b, 0x0d, 0xc4, 0x98, 0xbc,
+    0x88, 0xe1, 0x28, 0x3c, 0x04, 0x46, 0x50, 0x3c, 0x2b, 0x5d, 0x8c, 0xbc,
+    0xc2, 0x82, 0xc2, 0x3b, 0xfc, 0xd0, 0xe3, 0xba, 0x4b, 0x3b, 0x2b, 0xbc,
+    0xad, 0xaf, 0xd8, 0xba, 0xed, 0x38, 0x5f, 0xbc, 0x76, 0x04, 0xda, 0xbb,
+    0xee, 0x6e, 0xcb, 0x3b, 0x1b, 0x91, 0x76, 0xba, 0x57, 0x97, 0x12, 0x3b,
+    0xee, 0xc3, 0xe3, 0x3a, 0xca, 0x1a, 0x52, 0x3c, 0x03, 0x48, 0xcd, 0xbb,
+    0x53, 0x1a, 0x4d, 0x3c, 0x3d, 0xa1, 0x89, 0xbc, 0x88, 0x71, 0x3d, 0xbb,
+    0x25, 0x91, 0xc1, 0xbb, 0x5e, 0xdb, 0xfd, 0xba, 0xaa, 0x91, 0x5a, 0x3c,
+    0x63, 0x04, 0x02, 0x3a, 0x36, 0xa9, 0x9f, 0x3c, 0x0c, 0xe3, 0x6c, 0x3c,
+    0xe8, 0xca, 0x79, 0xbc, 0x01, 0x01, 0xf0, 0xbb, 0xb0, 0x64, 0x9c, 0xbc,
+    0x51, 0x31, 0x19, 0x3c, 0x5c, 0x8c, 0x9d, 0xbc, 0xbd, 0xed, 0x7c, 0x3c,
+    0x88, 0xf8, 0x48, 0xbc, 0x7d, 0xdf, 0x61, 0xbb, 0xce, 0x82, 0x8f, 0xbc,
+    0x5a, 0x64, 0xf7, 0xbb, 0x9e, 0xd0, 0x90, 0xbb, 0x97, 0xb9, 0x92, 0xbc,
+    0x8d, 0x57, 0x2f, 0x3c, 0x99, 0x82, 0x0a, 0x3c, 0x58, 0x46, 0xba, 0xbb,
+    0xfb, 0xab, 0x5b, 0x3c, 0x6e, 0x78, 0x8a, 0xbc, 0xa8, 0x24, 0x92, 0xbc,
+    0x8a, 0x14, 0xbe, 0xbb, 0xe5, 0xac, 0x83, 0x3c, 0x24, 0x14, 0x28, 0x3c,
+    0x38, 0xdc, 0xe1, 0x3b, 0x3d, 0x75, 0x24, 0x3b, 0x67, 0x13, 0x47, 0x3c,
+    0xab, 0x17, 0x66, 0xbb, 0xb2, 0xc8, 0x99, 0xbc, 0x05, 0x2f, 0x46, 0x3c,
+    0x96, 0xd6, 0x4a, 0xbc, 0x6f, 0x3f, 0x93, 0xbb, 0x60, 0xa2, 0xba, 0xbb,
+    0xc3, 0xd4, 0x76, 0xbc, 0x75, 0x94, 0xc3, 0xbb, 0xd5, 0x9f, 0x53, 0xbc,
+    0xc8, 0x0f, 0x98, 0x3b, 0x07, 0x1c, 0xc9, 0x3b, 0x49, 0x5e, 0x9f, 0xbc,
+    0x1f, 0x31, 0xe4, 0xba, 0x20, 0xb2, 0x0d, 0x3b, 0xb4, 0x92, 0x73, 0x3c,
+    0x7b, 0x75, 0x26, 0xb9, 0x5e, 0x7a, 0x89, 0xbc, 0x20, 0xe4, 0x92, 0xbc,
+    0xd3, 0x4f, 0x6d, 0x3c, 0x4d, 0x88, 0x3e, 0x3c, 0x95, 0xe9, 0x6a, 0x3c,
+    0x10, 0xd1, 0x1b, 0xbc, 0xac, 0xfb, 0xc1, 0x3b, 0xa1, 0x79, 0x84, 0xbc,
+    0xe0, 0x05, 0x56, 0x3c, 0x3c, 0x16, 0xda, 0xbb, 0x84, 0x24, 0x95, 0x3c,
+    0xac, 0x09, 0x96, 0xba, 0x1f, 0x01, 0x99, 0xbc, 0x18, 0x0a, 0x86, 0x3c,
+    0x99, 0x89, 0xa4, 0x3b, 0xd5, 0x89, 0x0b, 0xbc, 0xb5, 0xc7, 0x97, 0xbc,
+    0x2e, 0xa1, 0xa1, 0xbb, 0x3f, 0xe1, 0x60, 0xbc, 0xbd, 0x20, 0xfd, 0x3a,
+    0x17, 0x6b, 0x67, 0xbc, 0xaa, 0x3e, 0x55, 0xbc, 0x17, 0xe9, 0x89, 0x3c,
+    0x7b, 0xa8, 0xb7, 0x3b, 0xac, 0xb3, 0x28, 0xbc, 0x3f, 0x50, 0x78, 0x3c,
+    0xb0, 0x77, 0xa3, 0x3b, 0x95, 0x03, 0x92, 0x3c, 0x61, 0x21, 0x33, 0xba,
+    0xf6, 0x36, 0x7e, 0x3c, 0xce, 0xe3, 0xe9, 0x3b, 0xea, 0x5d, 0x95, 0xbc,
+    0x07, 0x34, 0x2a, 0xbc, 0x66, 0x25, 0x0f, 0xbc, 0x04, 0x42, 0x58, 0xbc,
+    0xf1, 0x94, 0x2b, 0xbc, 0xd6, 0x8a, 0x33, 0xbc, 0x8c, 0xf3, 0x77, 0x3c,
+    0x65, 0x84, 0xc2, 0xba, 0x34, 0xc0, 0x76, 0x3c, 0xe1, 0x3d, 0x6d, 0xbc,
+    0x0f, 0x2e, 0x2a, 0x3b, 0x4a, 0x6d, 0x9f, 0xbc, 0x4c, 0x00, 0x8d, 0x3c,
+    0x2a, 0xfe, 0xa1, 0xbc, 0xdd, 0x4c, 0x90, 0xbb, 0xba, 0xa5, 0x45, 0x3c,
+    0x1b, 0xcd, 0xa3, 0x3c, 0x72, 0x72, 0x9d, 0xbc, 0x86, 0x64, 0x54, 0x3c,
+    0x52, 0x8f, 0xd3, 0x39, 0x1a, 0x54, 0x97, 0xbc, 0xe6, 0x9c, 0x35, 0x3c,
+    0xf8, 0x57, 0x7e, 0xbc, 0x88, 0x1c, 0x92, 0x3b, 0x39, 0x67, 0x36, 0x3c,
+    0x73, 0x87, 0xe3, 0x3b, 0x7d, 0x73, 0x9d, 0xbb, 0xf4, 0x2c, 0x9b, 0xbc,
+    0x87, 0x14, 0x27, 0xbb, 0x35, 0x8f, 0x87, 0x3c, 0x9e, 0xfd, 0xda, 0xbb,
+    0x83, 0x2d, 0x25, 0xbc, 0xe7, 0x59, 0x6d, 0xbc, 0x73, 0x02, 0xd7, 0x39,
+    0x4b, 0xd7, 0xae, 0x3a, 0x4f, 0xe7, 0x8b, 0xbc, 0x3b, 0xce, 0x71, 0xbb,
+    0xa9, 0xfc, 0xcf, 0x3b, 0x2a, 0xb7, 0x98, 0x3c, 0xfa, 0x75, 0x33, 0xbb,
+    0xf5, 0xad, 0x27, 0xbb, 0x54, 0x57, 0x97, 0xba, 0xba, 0x33, 0x34, 0xbc,
+    0xa2, 0xd6, 0x89, 0xbb, 0xc1, 0x66, 0xbe, 0x3b, 0x33, 0xed, 0x86, 0xbb,
+    0x57, 0x52, 0x55, 0x3b, 0x5e, 0xed, 0x5b, 0x3c, 0x8c, 0x2c, 0xa3, 0x3c,
+    0xf0, 0x56, 0x7c, 0x3c, 0xea, 0x09, 0xa8, 0xbb, 0x70, 0xb8, 0x9c, 0xbc,
+    0x4a, 0x48, 0x92, 0x3b, 0x76, 0x6d, 0x85, 0xba, 0x35, 0x59, 0x2c, 0xbc,
+    0x16, 0xa2, 0x96, 0xbc, 0x18, 0xdf, 0xe9, 0xbb, 0x11, 0x58, 0x43, 0x3c,
+    0x20, 0x15, 0x98, 0x3c, 0xbd, 0xe3, 0x80, 0xbc, 0x61, 0x7d, 0x77, 0x3c,
+    0x4e, 0xe0, 0x93, 0xbc, 0x4d, 0xe7, 0x0b, 0x3c, 0x41, 0x0f, 0x9b, 0xbc,
+    0xa9, 0xf6, 0x4e, 0xbb, 0x6d, 0xa2, 0x72, 0x3c, 0xf4, 0x1a, 0x8c, 0xbb,
+    0x09, 0x1f, 0x8b, 0x3c, 0x36, 0xb8, 0x0b, 0x3c, 0x72, 0x8e, 0x88, 0x3b,
+    0x2b, 0xeb, 0x5d, 0xbc, 0xbc, 0x10, 0xd1, 0xbb, 0x5b, 0x0e, 0x69, 0xbb,
+    0x76, 0x77, 0x6c, 0x3b, 0xb2, 0x8a, 0xa2, 0x3c, 0x7c, 0xbf, 0x0d, 0xbc,
+    0x40, 0x70, 0x15, 0x39, 0x3f, 0x08, 0x8e, 0x3c, 0x2d, 0x9c, 0xca, 0xbb,
+    0x9b, 0x90, 0xa8, 0x3b, 0x77, 0x69, 0x2e, 0x3c, 0x44, 0xbf, 0xaa, 0x3b,
+    0x9d, 0x16, 0x26, 0x3c, 0x3e, 0x6e, 0x47, 0xbc, 0x44, 0xdc, 0x95, 0x3c,
+    0x8e, 0xbf, 0x53, 0xbc, 0x7d, 0x5d, 0x5b, 0x3b, 0x5f, 0xaa, 0x05, 0xbc,
+    0xe2, 0x30, 0xb0, 0x3b, 0xdb, 0xe5, 0x08, 0xbc, 0xef, 0x51, 0x34, 0xbb,
+    0xbe, 0xd7, 0xee, 0x3b, 0xd6, 0x57, 0x17, 0xbc, 0x3b, 0x57, 0x15, 0x3c,
+    0x54, 0xb3, 0xc8, 0xbb, 0xf7, 0x11, 0x71, 0xbc, 0xb3, 0x47, 0x94, 0x3b,
+    0x7f, 0x0c, 0x5b, 0xbc, 0xb0, 0xfc, 0x35, 0xbb, 0x2c, 0x2c, 0x85, 0xbb,
+    0x89, 0xe1, 0x8a, 0xbc, 0x50, 0x21, 0x0a, 0x3c, 0x52, 0x02, 0xed, 0x3b,
+    0x45, 0x0e, 0x36, 0x3c, 0x66, 0x79, 0xeb, 0x3a, 0xf0, 0x56, 0x0d, 0x3b,
+    0x7e, 0xc5, 0x58, 0xbc, 0x6a, 0xb7, 0x3f, 0xbc, 0x2c, 0x18, 0x32, 0xbc,
+    0xd2, 0xa9, 0x84, 0x3a, 0x66, 0x0c, 0x51, 0x3c, 0x86, 0x77, 0xbb, 0xbb,
+    0x7d, 0x43, 0x7a, 0x3c, 0xce, 0x95, 0x1a, 0x3c, 0xce, 0xd9, 0x0d, 0x3c,
+    0x0e, 0x0b, 0xd8, 0xbb, 0xdb, 0x08, 0x7a, 0xbc, 0xae, 0xa5, 0x97, 0x3c,
+    0xcb, 0x65, 0x68, 0x3c, 0xa8, 0xe5, 0x6e, 0xbb, 0xe6, 0x09, 0x6e, 0x3c,
+    0xc2, 0xd0, 0x82, 0x3c, 0x15, 0x79, 0xce, 0xbb, 0xcc, 0xfc, 0x82, 0x38,
+    0xf7, 0x79, 0xdc, 0xbb, 0xff, 0xcb, 0xff, 0x3b, 0x1a, 0x0f, 0x87, 0x3c,
+    0x81, 0xc6, 0x9e, 0x3c, 0x58, 0xc3, 0x1f, 0x3c, 0xd2, 0x45, 0xff, 0xbb,
+    0x2e, 0x5c, 0x79, 0x3c, 0xee, 0x6b, 0xa1, 0x3c, 0x46, 0x29, 0xc9, 0xbb,
+    0xb8, 0x08, 0x93, 0x3c, 0x4b, 0x25, 0xf2, 0x39, 0x72, 0x40, 0x98, 0x3c,
+    0x6a, 0x7b, 0xa2, 0x3c, 0xf9, 0x16, 0x4d, 0x3c, 0x43, 0x6f, 0xf0, 0x3b,
+    0xbd, 0xbe, 0x62, 0xbc, 0x8c, 0x3a, 0xa2, 0xbc, 0x67, 0x45, 0x7a, 0x3b,
+    0xae, 0xfe, 0x05, 0x3c, 0x94, 0xb7, 0x8e, 0x3c, 0xe2, 0x83, 0x33, 0x3a,
+    0x61, 0x01, 0x01, 0x3c, 0x76, 0x24, 0xc1, 0x3b, 0x30, 0x62, 0x41, 0xbc,
+    0x14, 0x23, 0xbd, 0x3b, 0xb4, 0xd9, 0x9d, 0x3c, 0x57, 0xd0, 0x7e, 0xbc,
+    0x9d, 0x20, 0xf7, 0x3b, 0x6f, 0xd2, 0x95, 0x3b, 0x3e, 0xb8, 0xa2, 0xbb,
+    0x96, 0x3f, 0x40, 0x3c, 0x6c, 0x67, 0xa0, 0xbc, 0xdf, 0x95, 0x80, 0x3c,
+    0xd6, 0xfc, 0x4f, 0x3c, 0x13, 0x53, 0x4a, 0xba, 0xac, 0x67, 0x80, 0xbc,
+    0xe0, 0x5c, 0xf8, 0xba, 0x2a, 0xdd, 0x5c, 0x3b, 0x80, 0x4b, 0x21, 0xbc,
+    0x53, 0x3a, 0x0d, 0xba, 0x9c, 0xb3, 0x34, 0x3c, 0x50, 0x85, 0x8a, 0x3c,
+    0x47, 0x99, 0x21, 0x3b, 0x10, 0x76, 0x56, 0x3c, 0x87, 0x4d, 0x8a, 0xbc,
+    0xa3, 0x8c, 0x69, 0x3c, 0x7c, 0xe4, 0x89, 0x3c, 0x20, 0x94, 0x59, 0xbc,
+    0x43, 0x9f, 0x56, 0x3c, 0x79, 0x17, 0x65, 0x3c, 0x6b, 0x28, 0x78, 0x3c,
+    0x8c, 0xb8, 0x33, 0x3a, 0x19, 0xe4, 0x8d, 0x3b, 0x81, 0x4f, 0x3f, 0xbc,
+    0xae, 0x66, 0x08, 0x3c, 0xcf, 0xfd, 0x78, 0xbb, 0x40, 0xe7, 0x9c, 0xbc,
+    0xcc, 0xaf, 0x6f, 0xbc, 0xce, 0x83, 0x92, 0xbb, 0x73, 0x6e, 0x7c, 0x3c,
+    0x09, 0x3e, 0x2a, 0x3b, 0x2c, 0x66, 0x88, 0x3c, 0xb7, 0xbb, 0x8c, 0x3c,
+    0x26, 0x66, 0x87, 0xbc, 0x5d, 0x40, 0x67, 0x3b, 0x2d, 0xe3, 0xd8, 0xbb,
+    0x09, 0x81, 0x8e, 0x39, 0x99, 0x2d, 0xe9, 0xba, 0x5e, 0x4f, 0x52, 0xba,
+    0xf3, 0x7a, 0x82, 0xbc, 0xfd, 0x56, 0x5a, 0x3c, 0x0f, 0xd8, 0xcb, 0xb9,
+    0xc0, 0x09, 0xbe, 0x3b, 0xf5, 0x3d, 0x8f, 0xba, 0x3c, 0x0c, 0x51, 0xbc,
+    0x0e, 0xf6, 0xd6, 0x3a, 0xc1, 0x1f, 0x5f, 0xbc, 0xe0, 0xcd, 0x66, 0x3c,
+    0xec, 0x51, 0x59, 0x3c, 0x7e, 0x8b, 0x69, 0xbc, 0xfe, 0x47, 0x8d, 0xbc,
+    0x86, 0x65, 0x8d, 0xbc, 0x5c, 0xed, 0x8b, 0xbb, 0xdf, 0x73, 0x94, 0x3c,
+    0x32, 0x2b, 0x13, 0x3b, 0x1d, 0xaa, 0x19, 0xbc, 0x66, 0x2d, 0x31, 0xbc,
+    0xa5, 0x04, 0x7f, 0xbc, 0x42, 0x3a, 0x6b, 0xbc, 0xf9, 0x61, 0x4c, 0x3c,
+    0x3f, 0xd3, 0x6c, 0xbc, 0x65, 0x97, 0x6e, 0x3c, 0x16, 0xae, 0x53, 0x3c,
+    0x5f, 0x05, 0x6e, 0xbc, 0x87, 0xf1, 0x19, 0x3b, 0x34, 0x87, 0xa1, 0xbc,
+    0x96, 0x43, 0x6d, 0x3c, 0x1d, 0xc5, 0x18, 0x3b, 0x02, 0x57, 0x27, 0x3c,
+    0x22, 0x79, 0xca, 0xb9, 0x05, 0x97, 0xf9, 0x3b, 0xf6, 0x4e, 0x8d, 0x3c,
+    0x84, 0x18, 0x1c, 0x3b, 0x26, 0x91, 0x75, 0x3c, 0x36, 0xb9, 0xcd, 0xbb,
+    0x6b, 0xe1, 0x83, 0xbc, 0x7a, 0x27, 0xa2, 0xbc, 0x79, 0x24, 0x33, 0xbc,
+    0x72, 0xe5, 0x5d, 0x3c, 0xa0, 0x13, 0xf7, 0xbb, 0xbe, 0x79, 0x34, 0xbc,
+    0xf9, 0x45, 0x37, 0xb9, 0x09, 0x71, 0x92, 0x3c, 0xad, 0x4a, 0xbc, 0x39,
+    0x9c, 0x92, 0xd0, 0xbb, 0xb8, 0x71, 0x8a, 0xbc, 0x0b, 0x1d, 0x41, 0x3b,
+    0x75, 0x66, 0x33, 0xbc, 0xea, 0xab, 0xad, 0xbb, 0x4b, 0xc3, 0x9b, 0xbb,
+    0x25, 0x34, 0x29, 0x3c, 0x35, 0xe1, 0x2f, 0xbc, 0x4a, 0xd5, 0x8e, 0x3c,
+    0xf8, 0xd9, 0x1e, 0x3c, 0xd9, 0xf9, 0x45, 0xba, 0x07, 0x59, 0x79, 0x3c,
+    0x62, 0x97, 0xb8, 0xbb, 0x19, 0x99, 0x97, 0xbb, 0x8b, 0xe5, 0x72, 0xbc,
+    0xf5, 0x8d, 0x36, 0x3c, 0x3e, 0x82, 0x81, 0xbb, 0xe9, 0xcd, 0x29, 0x37,
+    0x33, 0x35, 0x98, 0xba, 0xec, 0xb5, 0xcc, 0x3b, 0x3e, 0x3b, 0xa5, 0xbb,
+    0xfa, 0x44, 0x88, 0x3c, 0x33, 0x76, 0x32, 0xbb, 0xf3, 0x87, 0xb8, 0xbb,
+    0xce, 0xeb, 0x81, 0xbb, 0x02, 0x85, 0x2e, 0x3c, 0x96, 0x90, 0xa1, 0x3c,
+    0xf4, 0x32, 0x70, 0x3c, 0x95, 0x92, 0x54, 0xba, 0x18, 0xbc, 0x08, 0xbc,
+    0x79, 0x97, 0x0d, 0xbb, 0xb2, 0x73, 0xcc, 0xbb, 0x2e, 0x14, 0x28, 0xbc,
+    0x99, 0x2a, 0x4d, 0xbc, 0xa1, 0x61, 0x95, 0x3c, 0xb2, 0x23, 0xe9, 0xb7,
+    0x5c, 0x9b, 0x7f, 0xbc, 0x7a, 0x2a, 0x98, 0xbb, 0x68, 0xdc, 0x91, 0xbb,
+    0x78, 0xeb, 0x0d, 0x3a, 0xc9, 0x4c, 0x9d, 0x3c, 0xea, 0x2e, 0x9c, 0x3c,
+    0xca, 0xbc, 0x2c, 0x3b, 0xf1, 0xc8, 0x9a, 0x3b, 0x57, 0x33, 0xe6, 0x3b,
+    0x03, 0x69, 0xba, 0x38, 0xd1, 0xb0, 0x0b, 0xba, 0x70, 0x1b, 0xf3, 0xbb,
+    0xe5, 0x11, 0xf1, 0x3b, 0x4e, 0xba, 0x85, 0xbc, 0xe0, 0xab, 0xef, 0xbb,
+    0xa9, 0x1d, 0x80, 0x3c, 0x5b, 0xaa, 0x32, 0xbc, 0xa7, 0x37, 0x99, 0x3c,
+    0x1a, 0xa7, 0x9e, 0x3c, 0x73, 0x9c, 0x45, 0x3b, 0x06, 0x97, 0x96, 0xbc,
+    0x85, 0x35, 0x85, 0xbc, 0x0b, 0x69, 0x44, 0xbc, 0x65, 0x00, 0xe3, 0xbb,
+    0xac, 0x8d, 0x7d, 0xbc, 0xb2, 0xc7, 0x42, 0x3c, 0x2a, 0x0e, 0xb2, 0xbb,
+    0x13, 0x80, 0x2e, 0xbc, 0xbc, 0x85, 0x95, 0xbc, 0xcb, 0xc8, 0x99, 0xbb,
+    0xfd, 0x5c, 0xa2, 0xbc, 0x0f, 0x56, 0x7b, 0xbc, 0x35, 0x29, 0x89, 0x3b,
+    0xde, 0x85, 0x8e, 0x3c, 0x07, 0x06, 0x45, 0xbc, 0x5c, 0xfb, 0x1d, 0x3c,
+    0x99, 0x1c, 0x46, 0xbc, 0x9d, 0x59, 0xa3, 0xbc, 0x06, 0xf0, 0x81, 0x3c,
+    0x69, 0xd3, 0x62, 0x3c, 0x3c, 0xf5, 0x8d, 0xbc, 0xb6, 0x97, 0x53, 0xbc,
+    0xe8, 0x20, 0x2e, 0xbc, 0x33, 0x5a, 0x8c, 0x3c, 0x05, 0xc2, 0x9a, 0xbb,
+    0x1a, 0x72, 0x49, 0x3c, 0xcf, 0x42, 0x28, 0xbb, 0xad, 0xa7, 0x9b, 0xbb,
+    0x04, 0xe6, 0x2d, 0x3c, 0xf2, 0xba, 0x97, 0x3b, 0x12, 0x2e, 0x17, 0xbc,
+    0x40, 0x15, 0x59, 0x3b, 0xd5, 0x98, 0x05, 0x3c, 0x99, 0x5a, 0x56, 0x3c,
+    0x6f, 0x3b, 0xe8, 0x3b, 0xe1, 0x7a, 0xb8, 0x3b, 0xf9, 0x66, 0x7b, 0x3b,
+    0x3f, 0xad, 0x85, 0xbc, 0x2a, 0xe1, 0x91, 0x3c, 0x7e, 0xcc, 0x0c, 0x3c,
+    0xe7, 0xd9, 0x14, 0xbc, 0x2f, 0x1e, 0xfc, 0x3b, 0x9b, 0x5b, 0x9e, 0x3b,
+    0xb3, 0x35, 0xd0, 0x3b, 0x68, 0xb7, 0x9e, 0xbb, 0x7c, 0xd3, 0x3f, 0x3b,
+    0x3a, 0xc0, 0xd1, 0x3b, 0xce, 0x85, 0x43, 0xbc, 0xfb, 0x06, 0xa8, 0x39,
+    0x1a, 0xd0, 0x78, 0xbc, 0x80, 0x42, 0x81, 0xbc, 0x43, 0xb2, 0x86, 0x3c,
+    0x86, 0x0e, 0x76, 0xbc, 0xa0, 0xdd, 0x80, 0x3c, 0xd4, 0x56, 0x9e, 0xba,
+    0xaf, 0x70, 0xec, 0xba, 0x0f, 0xf5, 0xd1, 0xbb, 0x57, 0xa1, 0x5b, 0xbb,
+    0xfa, 0xe9, 0xa0, 0xbb, 0x51, 0x59, 0x2a, 0x3b, 0xba, 0x7d, 0xd7, 0xbb,
+    0x96, 0x02, 0x53, 0x3c, 0xec, 0x9c, 0x2e, 0xbc, 0xb6, 0xd7, 0x24, 0xbc,
+    0x8b, 0xee, 0x4b, 0xba, 0x43, 0x91, 0x8e, 0x3c, 0xd9, 0x00, 0x9c, 0xbc,
+    0x96, 0x6a, 0x12, 0x3c, 0x2c, 0xdf, 0xa1, 0xbc, 0x3b, 0x67, 0x79, 0xbb,
+    0x9f, 0x26, 0x2d, 0x3c, 0xb0, 0x59, 0x0d, 0xbb, 0x2e, 0xd7, 0x38, 0xbb,
+    0x58, 0xbb, 0x21, 0xbc, 0x12, 0x92, 0x82, 0xba, 0x7e, 0x16, 0x32, 0xbc,
+    0x1a, 0xdf, 0x0d, 0xbc, 0xc9, 0xec, 0xc8, 0x3b, 0xe5, 0x58, 0x82, 0x3b,
+    0xe4, 0xc0, 0x8c, 0x3c, 0x97, 0xa3, 0x99, 0x3c, 0x60, 0xac, 0x6a, 0x3a,
+    0x44, 0x26, 0x87, 0xbc, 0xb1, 0x22, 0x03, 0xbc, 0xa7, 0xb2, 0x3a, 0x3a,
+    0xd3, 0xf7, 0xe2, 0x3b, 0xbd, 0x35, 0x92, 0x3c, 0x5f, 0x07, 0x62, 0xbc,
+    0xb4, 0xd1, 0x97, 0xbc, 0xb0, 0x81, 0x72, 0x3c, 0x16, 0xfe, 0x47, 0x3c,
+    0x2a, 0x29, 0x2e, 0x3c, 0x56, 0x9f, 0xa4, 0xba, 0x4e, 0x05, 0xe9, 0x3b,
+    0xff, 0x13, 0x68, 0xbb, 0x29, 0xd1, 0x49, 0xbc, 0xfa, 0x01, 0x8f, 0xbb,
+    0x6d, 0x1e, 0x3c, 0x3c, 0xf8, 0xd2, 0x45, 0x3c, 0xc3, 0x1a, 0x97, 0x3c,
+    0xc0, 0x0f, 0x7e, 0x3c, 0x6f, 0xa9, 0xee, 0x3b, 0x49, 0x47, 0x5b, 0x3a,
+    0xb8, 0xc0, 0x12, 0x3c, 0x9e, 0x9d, 0x4f, 0xbc, 0xe7, 0xa2, 0x8a, 0x3c,
+    0x6e, 0x50, 0x0b, 0x3c, 0x2f, 0xb0, 0x77, 0x3b, 0xdb, 0xe7, 0x2c, 0xbb,
+    0x1f, 0x09, 0xaf, 0x3b, 0x6e, 0x3e, 0x9a, 0x3b, 0x4f, 0xb2, 0x82, 0x3c,
+    0x56, 0x6e, 0x39, 0x3b, 0x56, 0xd7, 0x3b, 0xbc, 0xa5, 0xab, 0x19, 0xbb,
+    0xba, 0x72, 0x28, 0xbc, 0xaf, 0xb1, 0x84, 0x3c, 0x11, 0x22, 0x61, 0x3c,
+    0x93, 0x53, 0x12, 0x3b, 0x0b, 0xf9, 0x46, 0xbc, 0x79, 0x92, 0x95, 0xbc,
+    0x2e, 0xc0, 0x6f, 0xbc, 0xe5, 0xd8, 0x14, 0xbb, 0x30, 0x55, 0xe4, 0x3b,
+    0x6f, 0xe1, 0x34, 0xbc, 0xc1, 0xda, 0xf1, 0x3b, 0x08, 0x35, 0x6d, 0x3c,
+    0xe4, 0x95, 0x28, 0x3c, 0xaa, 0x39, 0x43, 0xbb, 0x2c, 0x02, 0xbf, 0x3b,
+    0x3b, 0x07, 0xa0, 0x3c, 0x56, 0x95, 0x7c, 0x3c, 0x04, 0x24, 0xd4, 0xbb,
+    0xb5, 0x11, 0xf3, 0x3b, 0xc5, 0xb7, 0x5c, 0xbc, 0x54, 0x63, 0x16, 0x3b,
+    0x37, 0x0b, 0xbc, 0xbb, 0x4e, 0x25, 0x22, 0xbb, 0x49, 0x2c, 0x20, 0xbb,
+    0xe3, 0xf3, 0xd5, 0x3b, 0x7f, 0xc0, 0x62, 0x3c, 0x29, 0xc6, 0xa4, 0xba,
+    0x3c, 0x9d, 0x67, 0xbc, 0x03, 0x90, 0x26, 0x3c, 0xb1, 0xea, 0x24, 0x3c,
+    0x4c, 0xb7, 0x94, 0x3c, 0xe8, 0xdc, 0x8a, 0xbb, 0xc6, 0x60, 0xbd, 0xba,
+    0xaf, 0xd6, 0xd4, 0x3a, 0xb2, 0x7d, 0x80, 0x3c, 0xd9, 0xd5, 0x05, 0x3c,
+    0x1a, 0xde, 0x9c, 0xbc, 0x1b, 0xcf, 0x3f, 0xbc, 0xb4, 0xed, 0x67, 0x3c,
+    0x82, 0x10, 0x60, 0x3b, 0x6e, 0x0b, 0x75, 0x3c, 0x08, 0x43, 0x68, 0xbb,
+    0x6e, 0xbf, 0x3d, 0xbc, 0xb1, 0x7b, 0xa2, 0xbc, 0xc5, 0x8b, 0xa2, 0x3c,
+    0x0e, 0x4d, 0x6e, 0xbc, 0x5b, 0x64, 0xbb, 0x3b, 0xde, 0xd1, 0xd7, 0xb9,
+    0x31, 0x17, 0x9d, 0xbb, 0xe1, 0x0b, 0xc3, 0x3a, 0x24, 0x30, 0x8a, 0xbc,
+    0x54, 0x05, 0x9a, 0x3c, 0x40, 0x51, 0x98, 0xb9, 0x76, 0xd4, 0x9e, 0xbc,
+    0xb5, 0x6f, 0x53, 0xbb, 0x52, 0x8f, 0x28, 0x3c, 0x42, 0x4e, 0xf6, 0xbb,
+    0xf0, 0x93, 0x20, 0x3c, 0x05, 0x38, 0x2f, 0x3c, 0x48, 0xf8, 0x2a, 0xbc,
+    0x61, 0x58, 0x99, 0x3c, 0x90, 0xb3, 0x9a, 0xbc, 0xe1, 0x4a, 0x6e, 0x3c,
+    0xba, 0xa2, 0x04, 0x3a, 0x46, 0x29, 0x63, 0xbc, 0xf0, 0x56, 0x1e, 0xbc,
+    0x64, 0x26, 0x75, 0x3b, 0xb8, 0x30, 0x11, 0xbc, 0xa3, 0xc9, 0x5d, 0x3c,
+    0x4f, 0xcf, 0x37, 0xbc, 0x93, 0xf6, 0x97, 0xbb, 0xeb, 0xe1, 0x8e, 0x39,
+    0x46, 0x03, 0xd2, 0xbb, 0x23, 0x6e, 0x54, 0x3c, 0xfe, 0xbd, 0x1a, 0xbc,
+    0x18, 0xaf, 0x86, 0xbc, 0x6f, 0x3d, 0x62, 0xbc, 0xd4, 0x63, 0xa6, 0x3b,
+    0x2c, 0xa0, 0x26, 0x3b, 0x31, 0x19, 0x8f, 0xbc, 0xf6, 0x8f, 0xa1, 0x3c,
+    0xa2, 0x94, 0x57, 0xba, 0xd2, 0xaa, 0xec, 0xbb, 0x12, 0x2f, 0x16, 0x3c,
+    0x4b, 0xe1, 0x9b, 0xbc, 0xa7, 0x5c, 0x2c, 0xbb, 0x21, 0x80, 0xd7, 0x3b,
+    0xcc, 0x6e, 0x97, 0x3c, 0x89, 0x77, 0x2b, 0x3c, 0xfe, 0x6a, 0x7c, 0x3c,
+    0xfb, 0xc0, 0x79, 0xbc, 0x26, 0x1a, 0x38, 0xbb, 0x44, 0x6c, 0x99, 0xbc,
+    0x07, 0x6d, 0x15, 0xbc, 0x88, 0xa7, 0x97, 0xbb, 0xf3, 0xb4, 0xcc, 0xbb,
+    0x8f, 0x7d, 0xa5, 0xbb, 0x63, 0xa0, 0x46, 0x3c, 0xef, 0x75, 0x4b, 0xbc,
+    0x54, 0xa9, 0x54, 0x3c, 0x88, 0xc9, 0xdb, 0x3a, 0x28, 0x5c, 0xd3, 0xbb,
+    0xd4, 0xee, 0x08, 0x3b, 0xbd, 0xe3, 0x5d, 0xbc, 0x41, 0xa4, 0x3e, 0xb9,
+    0x77, 0xa5, 0x9c, 0xbc, 0x1d, 0xe1, 0x6d, 0x3c, 0x07, 0xc0, 0xdc, 0xbb,
+    0x81, 0x6a, 0xcc, 0xbb, 0x5c, 0x40, 0xa2, 0x3c, 0x6d, 0xb5, 0x94, 0x3b,
+    0xac, 0xdd, 0x57, 0xbb, 0x1b, 0x7c, 0x3e, 0x3c, 0xea, 0xaa, 0x8d, 0xbc,
+    0x92, 0xd2, 0x38, 0x3b, 0xb9, 0x10, 0x59, 0x3a, 0x08, 0xbc, 0x6c, 0x3c,
+    0x12, 0xf8, 0x61, 0x3b, 0x0f, 0x6e, 0x1a, 0xba, 0x60, 0x15, 0x54, 0x3a,
+    0x85, 0xbe, 0x38, 0x3c, 0xa4, 0x1e, 0xc8, 0xbb, 0xd2, 0x7d, 0x17, 0x3b,
+    0x50, 0xea, 0x07, 0x3c, 0x34, 0x62, 0xa2, 0x3c, 0xa2, 0xdd, 0xfd, 0x3b,
+    0x90, 0x58, 0x97, 0x3c, 0x04, 0x57, 0x84, 0xbb, 0xd8, 0x94, 0x8e, 0x3b,
+    0xa6, 0xc1, 0x20, 0x3c, 0x2b, 0xaf, 0xc6, 0xbb, 0x05, 0x46, 0x17, 0xbc,
+    0x1e, 0xf0, 0x9a, 0x3c, 0x91, 0x87, 0xc6, 0xbb, 0xe0, 0xce, 0xa3, 0x3c,
+    0x44, 0xdd, 0x66, 0x3c, 0xde, 0x13, 0x3a, 0xbc, 0x0c, 0x1a, 0x57, 0x3c,
+    0x95, 0x79, 0x9e, 0x3c, 0x5a, 0x43, 0x12, 0xbc, 0xbf, 0x8d, 0xd7, 0x3b,
+    0x91, 0xad, 0x30, 0x3c, 0xd7, 0x8c, 0x88, 0xbc, 0xfd, 0x46, 0x51, 0x3c,
+    0x78, 0x2f, 0xfb, 0xbb, 0x1f, 0x41, 0x07, 0x3c, 0x55, 0x80, 0x93, 0x3c,
+    0xe2, 0x55, 0x98, 0xbc, 0x9f, 0x6c, 0x92, 0x3b, 0xb9, 0x0c, 0x08, 0xbc,
+    0x87, 0x89, 0x7c, 0xbc, 0x56, 0xd7, 0x0a, 0x3c, 0x57, 0xf9, 0x9c, 0x3c,
+    0x7e, 0x47, 0x05, 0x3a, 0x54, 0x66, 0xc9, 0xbb, 0x65, 0x75, 0x05, 0xbb,
+    0xf8, 0xd2, 0x5f, 0xbb, 0x05, 0x42, 0xa7, 0x3a, 0x10, 0x17, 0x6e, 0xbb,
+    0xe9, 0x80, 0x89, 0xbc, 0x50, 0x19, 0x9d, 0x3c, 0xd4, 0xc2, 0xa2, 0x3c,
+    0x26, 0x8f, 0x55, 0xbc, 0x49, 0xb6, 0x29, 0xbc, 0xeb, 0x43, 0x25, 0xbb,
+    0xdb, 0x3d, 0x02, 0x3c, 0xa3, 0x91, 0x99, 0xbc, 0x26, 0xdf, 0x5b, 0x3c,
+    0x88, 0x72, 0xb5, 0x3b, 0x1e, 0x32, 0x17, 0xbc, 0x32, 0x0d, 0x73, 0x3c,
+    0xd6, 0x4c, 0xd3, 0x3b, 0x04, 0xf6, 0xef, 0xbb, 0xce, 0xd9, 0xfa, 0x3a,
+    0x5c, 0x09, 0x9d, 0x3c, 0x30, 0xf8, 0x93, 0xbc, 0x1f, 0x9e, 0x08, 0x3c,
+    0xe0, 0xfd, 0x64, 0x3c, 0xd4, 0x12, 0xfc, 0x3b, 0xe3, 0xea, 0x6b, 0xbc,
+    0xff, 0xab, 0x7e, 0x3b, 0x54, 0x67, 0x3b, 0x3c, 0x5c, 0x65, 0x55, 0xbb,
+    0xae, 0x14, 0x58, 0x3b, 0x37, 0x91, 0x21, 0xbc, 0x29, 0x6f, 0xf5, 0xbb,
+    0x7b, 0x39, 0x4a, 0x3c, 0x72, 0x3d, 0xdc, 0xb9, 0xdd, 0x2f, 0x06, 0xbb,
+    0x98, 0x25, 0x77, 0xbc, 0x94, 0x88, 0xa4, 0xbb, 0xa9, 0x46, 0x59, 0x3a,
+    0xa4, 0x48, 0x30, 0xbc, 0x04, 0xcf, 0x49, 0x3c, 0x91, 0x6f, 0x98, 0xbb,
+    0x22, 0x62, 0x2b, 0xbc, 0xb0, 0x44, 0xfb, 0xbb, 0xf3, 0xa3, 0x54, 0x3c,
+    0x03, 0x6e, 0x84, 0x3c, 0x95, 0xd4, 0x96, 0x3c, 0x78, 0xdc, 0x9e, 0xbc,
+    0x5e, 0x64, 0x26, 0x3c, 0x18, 0x9c, 0x85, 0x3a, 0x5e, 0x0c, 0x76, 0xbc,
+    0x9c, 0x1c, 0x26, 0xbc, 0x33, 0x12, 0x0f, 0xbc, 0x18, 0x17, 0x7b, 0xbb,
+    0x3e, 0x81, 0x99, 0xba, 0x81, 0x20, 0x8f, 0x3c, 0xdd, 0xb7, 0x90, 0xbc,
+    0xc9, 0x14, 0x09, 0x3c, 0x25, 0x11, 0x68, 0x3c, 0x34, 0x0a, 0xbb, 0xbb,
+    0x5f, 0x5a, 0x24, 0xbc, 0xad, 0xa4, 0x36, 0xbc, 0xa4, 0x85, 0x02, 0xbc,
+    0x1f, 0x75, 0x68, 0xbc, 0x83, 0x78, 0x07, 0x3b, 0x04, 0x94, 0x23, 0xbc,
+    0x04, 0xe9, 0x9a, 0xbc, 0xab, 0x38, 0x2f, 0xbc, 0x24, 0x21, 0x52, 0x3c,
+    0xe8, 0x9b, 0x58, 0xbb, 0xb5, 0x5a, 0x7b, 0x3c, 0x2d, 0x5d, 0x91, 0x3c,
+    0x01, 0x33, 0x28, 0xbc, 0xd5, 0x36, 0x1d, 0x3b, 0x6b, 0xbc, 0x79, 0x3c,
+    0x43, 0x70, 0x55, 0x3b, 0x4f, 0x94, 0x59, 0xbc, 0x6e, 0x2e, 0x25, 0xbc,
+    0xef, 0xc8, 0x9f, 0x3c, 0x4d, 0x79, 0x03, 0xbc, 0x53, 0xfa, 0x70, 0x3c,
+    0xdb, 0x56, 0x41, 0x3c, 0x4c, 0x96, 0x1e, 0x3c, 0xbb, 0x73, 0x11, 0x3c,
+    0xe2, 0x0a, 0x3e, 0x3c, 0x56, 0xad, 0x63, 0x3c, 0x5d, 0x67, 0x8f, 0xbc,
+    0x43, 0xb4, 0x59, 0xbc, 0xac, 0xea, 0x67, 0x39, 0x41, 0x6c, 0x3c, 0xbc,
+    0x7a, 0x28, 0xae, 0x3a, 0x09, 0xfa, 0x8e, 0xb9, 0x5c, 0x99, 0x74, 0xbc,
+    0x19, 0xac, 0x87, 0xbc, 0x88, 0x05, 0xa0, 0xbc, 0x03, 0x04, 0x55, 0x3c,
+    0x0d, 0x0e, 0x89, 0xbc, 0xe8, 0x3e, 0x97, 0x3c, 0xc2, 0x8a, 0x9e, 0x3c,
+    0x06, 0x05, 0x21, 0x3c, 0x37, 0x11, 0x02, 0xbb, 0x74, 0xf0, 0x12, 0xbc,
+    0x2f, 0x80, 0x65, 0xbb, 0xf7, 0xc6, 0xca, 0xbb, 0x94, 0xed, 0x87, 0xbb,
+    0x5b, 0x3d, 0x14, 0x3c, 0x7c, 0x9f, 0x80, 0x3c, 0xe4, 0x51, 0x60, 0xbc,
+    0xb6, 0xa4, 0x28, 0xbc, 0x39, 0x1f, 0x3e, 0xbc, 0x25, 0xfb, 0x94, 0xbc,
+    0xff, 0x20, 0x68, 0x3c, 0x1d, 0x77, 0xec, 0x39, 0xc1, 0xdf, 0x8d, 0xbc,
+    0x7c, 0xe3, 0x0c, 0xbb, 0x89, 0x78, 0x01, 0xbb, 0x45, 0x29, 0x36, 0x3c,
+    0x37, 0x4f, 0x2b, 0x3c, 0x92, 0x8a, 0x6f, 0xbc, 0x64, 0x4c, 0xa6, 0x3b,
+    0xe4, 0x22, 0xcb, 0x39, 0x45, 0x6b, 0x9f, 0xbc, 0x1f, 0xdc, 0x66, 0xbc,
+    0x0a, 0xb1, 0xda, 0x3b, 0xbc, 0x4a, 0xae, 0xbb, 0xc0, 0xf0, 0x97, 0x3c,
+    0xbe, 0xd4, 0x92, 0x38, 0x59, 0xc9, 0xf6, 0x3b, 0xc3, 0x1c, 0x70, 0xbc,
+    0xa0, 0x7f, 0x57, 0xba, 0x11, 0x6f, 0x19, 0x3c, 0xf1, 0x8c, 0x5a, 0x3c,
+    0x83, 0xdd, 0x44, 0xbc, 0x5d, 0x20, 0x87, 0xbb, 0x72, 0xcb, 0x8a, 0xba,
+    0x69, 0x4f, 0x1c, 0xbb, 0xa2, 0xc1, 0x80, 0xba, 0x43, 0xc2, 0x05, 0xbc,
+    0xbf, 0x52, 0x4a, 0x3c, 0x7d, 0x5b, 0x87, 0x3c, 0xf3, 0xea, 0xc5, 0xbb,
+    0x2a, 0xb2, 0xb4, 0x3b, 0x74, 0x5c, 0x9c, 0xbb, 0x91, 0x71, 0x4e, 0x3b,
+    0xfe, 0x25, 0x00, 0x3c, 0x9e, 0x63, 0x7e, 0x38, 0x06, 0xd4, 0xe4, 0x3b,
+    0xe6, 0x85, 0x28, 0x3c, 0x73, 0xfb, 0x60, 0x3c, 0x09, 0xf1, 0x4b, 0xbc,
+    0xb8, 0xde, 0x39, 0xbc, 0xce, 0xb1, 0x16, 0x3a, 0xba, 0x85, 0xca, 0x39,
+    0xc5, 0xab, 0x49, 0x3c, 0x23, 0x47, 0x36, 0x3a, 0xd5, 0x16, 0x83, 0x3c,
+    0x07, 0xee, 0x35, 0x3c, 0xc1, 0x73, 0x84, 0x39, 0x70, 0xdc, 0x55, 0x3c,
+    0x29, 0x2b, 0x7d, 0xba, 0x94, 0x77, 0xcf, 0xbb, 0xc6, 0x86, 0x2e, 0xbb,
+    0x9c, 0x98, 0xe5, 0xba, 0x24, 0x4e, 0xc5, 0x3b, 0xc9, 0xbf, 0x92, 0xbc,
+    0x2b, 0x69, 0x16, 0x3c, 0x36, 0x6e, 0x99, 0x3c, 0x20, 0xea, 0xd7, 0xba,
+    0x00, 0x4e, 0x8d, 0xbc, 0xdd, 0xc8, 0x43, 0xbc, 0xd2, 0x04, 0x82, 0xbc,
+    0x13, 0xad, 0x1f, 0xbc, 0x6e, 0x9d, 0x40, 0x3c, 0x02, 0x7f, 0xa3, 0xbc,
+    0x36, 0xd4, 0x74, 0x3c, 0xe3, 0x07, 0x90, 0x3c, 0xb7, 0x6f, 0x4e, 0xbc,
+    0x1c, 0xeb, 0x55, 0xbc, 0x07, 0x9f, 0x98, 0x3c, 0xa5, 0x00, 0xb7, 0xbb,
+    0x62, 0x53, 0x4c, 0x3c, 0x2b, 0xe3, 0xa0, 0xbc, 0x95, 0xd2, 0xa0, 0x3c,
+    0xbe, 0x6f, 0x9e, 0xbc, 0xb4, 0xfe, 0x8c, 0x3b, 0x05, 0x65, 0x8c, 0x3c,
+    0x5a, 0x18, 0x59, 0x3c, 0x58, 0x82, 0xf8, 0xbb, 0x20, 0x14, 0x53, 0x3c,
+    0x42, 0x2f, 0x8c, 0xbb, 0x4c, 0xe9, 0x01, 0xb7, 0x4a, 0x34, 0xb3, 0xbb,
+    0x87, 0x6c, 0xbe, 0xbb, 0xc1, 0x27, 0x57, 0x3b, 0x28, 0xdb, 0x38, 0x3c,
+    0x0f, 0xbd, 0x02, 0x3c, 0x05, 0xb0, 0x2f, 0x3c, 0xb6, 0x29, 0x9f, 0xbc,
+    0x27, 0x2a, 0xa6, 0x3a, 0xf3, 0xf3, 0xc0, 0xbb, 0x52, 0xf6, 0x3e, 0xbc,
+    0x9c, 0xe7, 0x89, 0x3c, 0x2b, 0xb3, 0x46, 0xbc, 0x51, 0xc8, 0x4e, 0xbc,
+    0x0e, 0x7e, 0x52, 0xbc, 0xd9, 0x37, 0xcf, 0x3b, 0xb3, 0x75, 0x92, 0x3b,
+    0xea, 0x48, 0x6c, 0x39, 0xac, 0x8b, 0x63, 0x3b, 0x38, 0x5e, 0x90, 0x3c,
+    0xff, 0xb8, 0x6c, 0x3c, 0x41, 0x04, 0x85, 0x3c, 0xf4, 0x17, 0x92, 0xbc,
+    0x66, 0x39, 0x82, 0x3c, 0x28, 0x91, 0x99, 0xbc, 0xc0, 0x84, 0xc1, 0x3b,
+    0xd3, 0x2c, 0x8d, 0x3c, 0x9d, 0xa5, 0xce, 0x38, 0xfc, 0x7e, 0x53, 0xbb,
+    0xb2, 0x89, 0xdc, 0xbb, 0xfb, 0x5a, 0x88, 0x3c, 0xe4, 0x94, 0x8b, 0x3c,
+    0xe3, 0x23, 0x9c, 0x3b, 0x37, 0x87, 0x0c, 0x3c, 0x02, 0xdc, 0xd2, 0xbb,
+    0x33, 0x20, 0x6d, 0xbc, 0x84, 0xf5, 0x9c, 0x3c, 0xe1, 0xcf, 0xcd, 0x3b,
+    0x7d, 0xdb, 0x13, 0xbc, 0xab, 0x54, 0x9c, 0x3c, 0x3e, 0xd4, 0x8e, 0x3b,
+    0x36, 0x0e, 0xde, 0xbb, 0x33, 0xb3, 0x81, 0x3c, 0x47, 0x50, 0x8a, 0xbc,
+    0x84, 0x54, 0x47, 0x3c, 0x2a, 0x19, 0x5f, 0xbc, 0xa7, 0x8e, 0x80, 0xbc,
+    0x79, 0xfa, 0x1d, 0xbc, 0xbf, 0xc9, 0x0c, 0x3c, 0x92, 0x91, 0x8d, 0x3b,
+    0x30, 0x5d, 0x4e, 0xbb, 0x8f, 0x72, 0x5f, 0xbc, 0xe2, 0xda, 0x8a, 0x3c,
+    0x3d, 0x83, 0x2e, 0x3c, 0xb6, 0x24, 0xf4, 0x3b, 0x6e, 0x11, 0x4d, 0x3c,
+    0xb8, 0xba, 0x33, 0x3c, 0x4b, 0x00, 0x7e, 0xbc, 0x3a, 0x25, 0x33, 0x3c,
+    0xb3, 0xfc, 0x5d, 0x3c, 0xc4, 0xb6, 0x21, 0x3c, 0x13, 0xd6, 0x39, 0xba,
+    0xc7, 0x60, 0xf4, 0x3b, 0xcb, 0x11, 0x83, 0xbc, 0xcb, 0x3d, 0x2d, 0x3c,
+    0x90, 0xd3, 0x1b, 0xbc, 0x45, 0xdc, 0x3a, 0x3c, 0xce, 0x51, 0xb1, 0x3b,
+    0x98, 0x63, 0xbe, 0x39, 0x68, 0xd5, 0xbc, 0x3a, 0x2a, 0x5a, 0x8b, 0xbc,
+    0x46, 0x70, 0x96, 0xbc, 0x72, 0xfb, 0x9e, 0xbc, 0x5b, 0x94, 0x34, 0x3c,
+    0x6c, 0xea, 0x6c, 0xbc, 0x7f, 0x28, 0x77, 0xbc, 0x87, 0xa6, 0x96, 0xbb,
+    0xa1, 0x88, 0x9c, 0x3c, 0x5a, 0xeb, 0x7c, 0x3c, 0xce, 0xb9, 0xf4, 0xbb,
+    0x47, 0x95, 0x51, 0x3c, 0x33, 0xf6, 0x87, 0xbc, 0x40, 0x81, 0x8d, 0xbb,
+    0x1b, 0xa2, 0x4f, 0x3b, 0x59, 0x55, 0x9f, 0x3c, 0x34, 0xe1, 0x93, 0xbc,
+    0x43, 0x95, 0x65, 0xbb, 0x7a, 0x7f, 0x89, 0x3c, 0xe3, 0xca, 0x9a, 0xbc,
+    0x88, 0xde, 0x81, 0x3b, 0xdb, 0xdd, 0x83, 0xbb, 0x7c, 0xfd, 0x1d, 0x3b,
+    0x5f, 0x44, 0x05, 0x3c, 0xa6, 0x97, 0x74, 0xbb, 0xba, 0x77, 0x80, 0x3c,
+    0x1b, 0x54, 0x95, 0x3c, 0xb6, 0xf1, 0x9e, 0x3c, 0xe3, 0xe3, 0x91, 0xbc,
+    0x9b, 0xbe, 0x5c, 0x3c, 0x60, 0xf8, 0x77, 0x3c, 0x20, 0x63, 0x68, 0xbc,
+    0xca, 0xa5, 0x90, 0x3c, 0xea, 0x5f, 0x74, 0xbc, 0x8d, 0xd0, 0x3f, 0xbc,
+    0x07, 0x46, 0x95, 0x3c, 0x35, 0xc8, 0x58, 0x3c, 0xa2, 0xac, 0x48, 0x3b,
+    0xdb, 0x0f, 0x0b, 0xbc, 0x75, 0x0f, 0x22, 0xbc, 0xa2, 0xea, 0x7d, 0xbb,
+    0x9c, 0xe4, 0xa0, 0xbc, 0x8d, 0xba, 0xb2, 0x3b, 0xb4, 0xf2, 0x92, 0xbc,
+    0xc4, 0x78, 0x33, 0x3c, 0x49, 0xd9, 0x8c, 0xbc, 0xd7, 0x7a, 0xa0, 0xbc,
+    0x8f, 0x20, 0x0d, 0xbc, 0x22, 0xb6, 0x32, 0x3c, 0x3b, 0xff, 0x59, 0x3c,
+    0x68, 0x26, 0x99, 0x39, 0x0b, 0x9f, 0x8f, 0x3c, 0x50, 0xa1, 0x7c, 0xbc,
+    0xd3, 0xe9, 0xdb, 0xbb, 0x40, 0x83, 0x1d, 0x3c, 0xff, 0x93, 0xe7, 0xbb,
+    0x98, 0x6a, 0x68, 0xbc, 0x05, 0x6b, 0x4d, 0x3b, 0xf4, 0x55, 0x8f, 0xbc,
+    0x7c, 0x70, 0xa6, 0xbb, 0xf9, 0x4d, 0x21, 0xbc, 0x68, 0x72, 0xdc, 0xbb,
+    0x2c, 0x60, 0x1b, 0xba, 0x04, 0x2f, 0xbb, 0x3a, 0xa0, 0x32, 0x88, 0xbc,
+    0x7e, 0xca, 0xf1, 0xbb, 0xe6, 0x70, 0x98, 0xbb, 0x51, 0x7b, 0x7d, 0xbb,
+    0x30, 0x58, 0x51, 0xba, 0x71, 0x52, 0x42, 0xbb, 0x28, 0x95, 0x8b, 0xbc,
+    0x85, 0xf1, 0x37, 0xbc, 0x5c, 0x1e, 0xbd, 0x3b, 0x73, 0x75, 0x57, 0x3c,
+    0x55, 0xed, 0xef, 0x39, 0xf6, 0x8f, 0x66, 0xbc, 0xd7, 0xbf, 0x8c, 0xbc,
+    0x60, 0x83, 0x61, 0xbc, 0x52, 0xfb, 0x97, 0xbb, 0x49, 0xef, 0x2a, 0x3b,
+    0x95, 0x4b, 0xd7, 0x3b, 0x0c, 0x6d, 0x7f, 0x3a, 0xd2, 0x27, 0x2b, 0x3b,
+    0x3d, 0xae, 0xc1, 0xbb, 0x1a, 0x0d, 0xd9, 0x3b, 0xd5, 0xac, 0x14, 0x3c,
+    0x44, 0x49, 0x80, 0xbb, 0x8c, 0x61, 0x4e, 0x3c, 0x01, 0xdd, 0x1f, 0x3c,
+    0x63, 0xa0, 0x84, 0x3c, 0xaa, 0x55, 0xae, 0xba, 0xe7, 0xde, 0xca, 0xbb,
+    0x0f, 0xab, 0x35, 0x3c, 0x79, 0x85, 0x97, 0xbc, 0xa7, 0x34, 0x98, 0xbb,
+    0xde, 0x5d, 0x9c, 0x3c, 0x75, 0xbf, 0xce, 0xbb, 0xa9, 0x35, 0x01, 0x3a,
+    0xb5, 0xfd, 0x23, 0xbc, 0x42, 0xa0, 0x8a, 0xbc, 0x77, 0xf7, 0x7e, 0xbc,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 static const size_t DEFAULT_MODEL_SIZE = sizeof(DEFAULT_MODEL_DATA);
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "ner_model.hpp"
+
+#include "duckdb.hpp"
+#include "duckdb/common/mutex.hpp"
+
+#include <atomic>
+#include <list>
+#include <unordered_map>
+
+namespace duckdb {
+
+struct NerCacheStats {
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t evictions = 0;
+	idx_t entries = 0;
+	idx_t capacity = 0;
+	idx_t memory = 0;
+};
+
+//! Bounded LRU cache of ner() results shared by all threads, keyed by a hash of the input text and of everything
+//! else the result depends on (model, options). Texts are stored with their entities, so hash collisions miss.
+class NerResultCache {
+public:
+	NerResultCache();
+
+	//! Maximum number of cached texts, split exactly between the shards; 0 disables the cache and drops its content
+	void SetCapacity(idx_t capacity);
+	//! Texts longer than this many bytes are not cached
+	void SetMaxTextLength(idx_t length);
+	bool Enabled() const {
+		return capacity.load(std::memory_order_relaxed) > 0;
+	}
+	bool Admits(idx_t text_len) const {
+		return Enabled() && text_len <= max_text_length.load(std::memory_order_relaxed);
+	}
+
+	bool Lookup(hash_t key, const char *text, idx_t text_len, vector<ner_entity> &entities);
+	void Insert(hash_t key, const char *text, idx_t text_len, const vector<ner_entity> &entities);
+	NerCacheStats GetStats() const;
+
+private:
+	static constexpr idx_t SHARD_COUNT = 16;
+
+	struct Entry {
+		hash_t key;
+		std::string text;
+		vector<ner_entity> entities;
+
+		idx_t Memory() const {
+			return sizeof(Entry) + text.capacity() + entities.capacity() * sizeof(ner_entity);
+		}
+	};
+
+	//! Each shard is an independent LRU list, most recently used first
+	struct Shard {
+		mutable mutex lock;
+		std::list<Entry> lru;
+		std::unordered_map<hash_t, std::list<Entry>::iterator> index;
+		idx_t memory = 0;
+	};
+
+	//! Shard of key: one of the first n_shards
+	idx_t GetShard(hash_t key) const {
+		return key % n_shards.load();
+	}
+	//! Entries shard i may hold: capacity is divided between the n_shards in use, the first ones taking the
+	//! remainder, so that the shards never hold more than capacity entries in total
+	idx_t ShardCapacity(idx_t i) const;
+	void Evict(Shard &shard, idx_t shard_capacity);
+
+	Shard shards[SHARD_COUNT];
+	std::atomic<idx_t> capacity;
+	//! Shards in use: fewer than SHARD_COUNT for small capacities, so that every key can be cached
+	std::atomic<idx_t> n_shards;
+	std::atomic<idx_t> max_text_length;
+	std::atomic<idx_t> hits;
+	std::atomic<idx_t> misses;
+	std::atomic<idx_t> evictions;
+};
+
+} // namespace duckdb
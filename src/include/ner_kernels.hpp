@@ -0,0 +1,48 @@
+#ifndef NER_KERNELS_HPP
+#define NER_KERNELS_HPP
+
+#include "ggml.h"
+
+// Fused element-wise operations of the encoder graph, implemented as ggml custom operations.
+// They work on contiguous F32 tensors and broadcast their smaller operands instead of materializing them
+// with ggml_repeat, so that each produces a single intermediate in the compute arena.
+// Their operands are only asserted: model weights passed as bias or LayerNorm parameters are checked with
+// ner_fused_operand when the model is loaded.
+
+// Whether t can be a bias or LayerNorm parameter of the operations below: contiguous F32 values
+bool ner_fused_operand(const struct ggml_tensor *t);
+
+// a + b, where b has the row length of a and each of its other dimensions is either 1 or equal to a's
+struct ggml_tensor *ner_add_bcast(struct ggml_context *ctx, struct ggml_tensor *a, struct ggml_tensor *b);
+
+// gelu(a + bias), bias being a single row
+struct ggml_tensor *ner_add_gelu(struct ggml_context *ctx, struct ggml_tensor *a, struct ggml_tensor *bias);
+
+// a + bias + residual, bias being a single row and residual having the shape of a
+struct ggml_tensor *ner_add_residual(struct ggml_context *ctx, struct ggml_tensor *a, struct ggml_tensor *bias,
+                                     struct ggml_tensor *residual);
+
+// LayerNorm of each row of a (eps = 1e-12, as in BERT), followed by the affine transform w * x + b
+struct ggml_tensor *ner_norm_affine(struct ggml_context *ctx, struct ggml_tensor *a, struct ggml_tensor *w,
+                                    struct ggml_tensor *b);
+
+// Parameters of ner_attention
+struct ner_attention_params {
+	// [N, 1, 1, B]: 0 for the keys of each sequence to attend to, -inf for padding
+	struct ggml_tensor *mask;
+	int32_t n_head;
+	// applied to the dot products of queries and keys, usually 1/sqrt(d_head)
+	float scale;
+};
+
+// Multi-head self-attention softmax(scale * Q K^T + mask) V of B sequences of N tokens, fused in the style of flash
+// attention: tiles of queries are run against tiles of keys with an online softmax, so that neither the [N, N]
+// scores of a head nor transposed copies of K and V are ever materialized.
+// q, k and v are the [n_embd, N * B] projections, each head being a slice of n_embd / n_head values of every row.
+// Their rows may be strided, e.g. views of one fused projection. The result is a new contiguous tensor of the same
+// shape, ready for the output projection. Queries at padded positions get zeros.
+// params must stay valid for as long as the graph is computed.
+struct ggml_tensor *ner_attention(struct ggml_context *ctx, struct ggml_tensor *q, struct ggml_tensor *k,
+                                  struct ggml_tensor *v, const struct ner_attention_params *params);
+
+#endif // NER_KERNELS_HPP
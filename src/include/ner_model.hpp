@@ -10,24 +10,115 @@ extern "C" {
 #endif
 
 struct ner_ctx;
+struct ner_exec;
 
 typedef int32_t ner_vocab_id;
 
+// Byte range [start, end) of a token in the tokenized text
+struct ner_span {
+	int32_t start;
+	int32_t end;
+};
+
+// Entity found by ner_decode: byte range [start, end) of the tokenized text, entity type (see ner_label_type), and
+// score, the mean probability of the labels predicted for its tokens
+struct ner_entity {
+	int32_t start;
+	int32_t end;
+	int32_t type;
+	float score;
+};
+
+// The model file is memory-mapped and its weights are used in place whenever they are aligned.
 struct ner_ctx *ner_load_from_file(const char *fname);
+// Same as ner_load_from_file, over an in-memory model image. data must outlive the returned context.
 struct ner_ctx *ner_load_from_memory(const uint8_t *data, size_t size);
 void ner_free(struct ner_ctx *ctx);
 
-void ner_tokenize(struct ner_ctx *ctx, const char *text, ner_vocab_id *tokens, int32_t *n_tokens, int32_t n_max_tokens);
+// Per-thread execution context: owns the compute arena and shares the read-only weights of ctx.
+// ctx must outlive every execution context created from it.
+struct ner_exec *ner_exec_init(struct ner_ctx *ctx);
+void ner_exec_free(struct ner_exec *exec);
+// Keeps the compute buffers of exec under limit bytes (0: no limit) by splitting batches and evicting cached graphs.
+// A single sequence is always evaluated, even if it needs more.
+void ner_exec_set_memory_limit(struct ner_exec *exec, size_t limit);
+// Bytes currently held by the compute buffers of exec
+size_t ner_exec_memory_usage(struct ner_exec *exec);
+
+// Tokenizes text[0..text_len) into at most n_max_tokens tokens, [CLS] and [SEP] included.
+// text does not need to be NUL-terminated and is never copied.
+void ner_tokenize(struct ner_ctx *ctx, const char *text, size_t text_len, ner_vocab_id *tokens, int32_t *n_tokens,
+                  int32_t n_max_tokens);
+// Same as ner_tokenize, also writing the byte range of each token to spans ([CLS] and [SEP] get empty ranges).
+// Returns true if the text was truncated, i.e. some of its words did not fit in n_max_tokens.
+bool ner_tokenize_spans(struct ner_ctx *ctx, const char *text, size_t text_len, ner_vocab_id *tokens,
+                        struct ner_span *spans, int32_t *n_tokens, int32_t n_max_tokens);
+
+// Cheap test of whether text[0..text_len) may contain entities, to skip ner_eval on texts that cannot: false when no
+// word is capitalized, except at the start of a sentence and when the vocabulary also knows it in lowercase ("The").
+// A heuristic for cased models: always true with uncased ones, and for text in scripts without case.
+bool ner_prefilter(struct ner_ctx *ctx, const char *text, size_t text_len);
 
 // Returns logits for each token: [n_tokens, n_labels]
-void ner_eval(struct ner_ctx *ctx, int32_t n_threads, ner_vocab_id *tokens, int32_t n_tokens, float *logits);
+void ner_eval(struct ner_exec *exec, int32_t n_threads, ner_vocab_id *tokens, int32_t n_tokens, float *logits);
+
+// Length to which a sequence of n_tokens is padded. Graphs are built once per padded length and reused.
+int32_t ner_seq_bucket(struct ner_ctx *ctx, int32_t n_tokens);
+
+// Padded tokens per batch that callers of ner_eval_batch should aim for: enough rows for the matrix multiplications to
+// reach full speed. Batches larger than the memory limit of the execution context are split anyway.
+#define NER_BATCH_TOKENS 2048
+
+// Evaluates n_batch sequences in a single graph. Sequence b holds n_tokens[b] tokens starting at tokens[b * n_stride],
+// and its logits are written to logits[b * n_stride * n_labels]. Shorter sequences are padded and masked.
+void ner_eval_batch(struct ner_exec *exec, int32_t n_threads, const ner_vocab_id *tokens, const int32_t *n_tokens,
+                    int32_t n_batch, int32_t n_stride, float *logits);
+
+// Merges the predictions of n_tokens tokens (logits: [n_tokens, n_labels]) into at most n_max_entities entities,
+// using the spans of ner_tokenize_spans. Returns the number of entities, never more than n_tokens.
+int32_t ner_decode(struct ner_ctx *ctx, const ner_vocab_id *tokens, const struct ner_span *spans, int32_t n_tokens,
+                   const float *logits, struct ner_entity *entities, int32_t n_max_entities);
 
 int32_t ner_n_embd(struct ner_ctx *ctx);
 int32_t ner_n_max_tokens(struct ner_ctx *ctx);
 int32_t ner_n_labels(struct ner_ctx *ctx);
+// Entity types of the model's labels ("PER", "LOC", ...), type 0 being "O"
+int32_t ner_n_label_types(struct ner_ctx *ctx);
+const char *ner_label_type(struct ner_ctx *ctx, int32_t type);
 
 const char *ner_vocab_id_to_token(struct ner_ctx *ctx, ner_vocab_id id);
 
+// Buckets of the ner_stats histograms: bucket i counts values in [2^(i-1), 2^i), bucket 0 the value 0
+#define NER_STATS_HIST_BUCKETS 32
+
+// Process-wide counters of the calls above, updated with relaxed atomics. Times are wall-clock nanoseconds summed
+// over all threads. Every field is a uint64_t.
+struct ner_stats {
+	uint64_t n_tokenized;      // texts tokenized
+	uint64_t n_tokens;         // tokens produced, [CLS] and [SEP] included
+	uint64_t n_truncated;      // texts cut at n_max_tokens
+	uint64_t n_unknown;        // bytes of words skipped by WordPiece, no vocabulary token matching them
+	uint64_t tokenize_ns;
+	uint64_t n_prefiltered;    // texts tested by ner_prefilter
+	uint64_t n_prefilter_skip; // texts ner_prefilter found free of entities
+	uint64_t prefilter_ns;
+	uint64_t n_graph_builds;   // graphs built, i.e. evaluations of a (padded) shape not cached by the exec
+	uint64_t graph_build_ns;
+	uint64_t n_computes;       // graph computes, one per batch
+	uint64_t n_sequences;      // sequences evaluated, padding sequences excluded
+	uint64_t n_padded_tokens;  // tokens evaluated, padding included
+	uint64_t compute_ns;
+	uint64_t n_decoded;        // sequences decoded
+	uint64_t n_entities;
+	uint64_t decode_ns;
+	uint64_t arena_high_water; // largest compute buffers (bytes) held by an execution context
+	uint64_t compute_us_hist[NER_STATS_HIST_BUCKETS];    // graph computes by duration in microseconds
+	uint64_t batch_tokens_hist[NER_STATS_HIST_BUCKETS]; // graph computes by number of padded tokens
+};
+
+void ner_stats_get(struct ner_stats *stats);
+void ner_stats_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,43 @@
+#ifndef NER_UNICODE_HPP
+#define NER_UNICODE_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Character classes of BERT's basic tokenizer, which splits text into words before WordPiece: words are separated
+// by whitespace, punctuation characters and CJK ideographs are words of their own, and control characters are
+// removed. Models with a lowercase vocabulary also get their words lowercased and stripped of accents.
+
+enum ner_char_class : uint8_t {
+	NER_CHAR_WORD,    // part of a word
+	NER_CHAR_SPACE,   // separates words
+	NER_CHAR_PUNCT,   // a word of its own, ASCII symbols such as '$' included
+	NER_CHAR_CJK,     // CJK ideograph, a word of its own
+	NER_CHAR_REMOVED, // control and format characters, U+FFFD and invalid UTF-8
+};
+
+// Classes of the ASCII bytes
+extern const uint8_t NER_ASCII_CLASS[128];
+
+// Decodes the UTF-8 sequence at p (p < end) into cp. Returns its length, or 0 if it is invalid (truncated,
+// overlong, a surrogate or out of range).
+size_t ner_utf8_decode(const char *p, const char *end, uint32_t *cp);
+
+// Writes the UTF-8 encoding of cp to out (4 bytes at most), returns its length
+size_t ner_utf8_encode(uint32_t cp, char *out);
+
+// Class of the code point
+ner_char_class ner_char_classify(uint32_t cp);
+
+// Digits, lowercase letters and nonspacing marks: the characters that never start a proper noun in scripts with case
+bool ner_char_is_lower(uint32_t cp);
+
+// Lowercase form of cp without accents, as BERT's uncased models see it: lowercased, decomposed (NFD) and
+// stripped of nonspacing marks. Writes up to 3 code points to out and returns their number, 0 for marks.
+size_t ner_char_fold(uint32_t cp, uint32_t *out);
+
+// End of the run of ASCII letters and digits starting at p, uppercase letters excluded if lowercase is set: the
+// words that need no further processing. Classifies 16 bytes at a time with SSE2, NEON or WebAssembly SIMD.
+const char *ner_scan_word(const char *p, const char *end, bool lowercase);
+
+#endif // NER_UNICODE_HPP
@@ -0,0 +1,91 @@
+#include "ner_cache.hpp"
+
+namespace duckdb {
+
+NerResultCache::NerResultCache()
+    : capacity(0), n_shards(1), max_text_length(4096), hits(0), misses(0), evictions(0) {
+}
+
+void NerResultCache::SetCapacity(idx_t capacity_p) {
+	const idx_t n_shards_p = MaxValue<idx_t>(1, MinValue<idx_t>(capacity_p, SHARD_COUNT));
+	const bool remap = n_shards_p != n_shards.load();
+	capacity = capacity_p;
+	n_shards = n_shards_p;
+	for (idx_t i = 0; i < SHARD_COUNT; i++) {
+		lock_guard<mutex> guard(shards[i].lock);
+		// entries are in the shard of their key, which changes with the number of shards
+		Evict(shards[i], remap ? 0 : ShardCapacity(i));
+	}
+}
+
+idx_t NerResultCache::ShardCapacity(idx_t i) const {
+	const idx_t n = n_shards.load();
+	const idx_t total = capacity.load();
+	return i < n ? total / n + (i < total % n ? 1 : 0) : 0;
+}
+
+void NerResultCache::SetMaxTextLength(idx_t length) {
+	max_text_length = length;
+}
+
+bool NerResultCache::Lookup(hash_t key, const char *text, idx_t text_len, vector<ner_entity> &entities) {
+	auto &shard = shards[GetShard(key)];
+	lock_guard<mutex> guard(shard.lock);
+	auto it = shard.index.find(key);
+	if (it == shard.index.end() || it->second->text.size() != text_len ||
+	    memcmp(it->second->text.data(), text, text_len) != 0) {
+		misses++;
+		return false;
+	}
+	shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+	entities = it->second->entities;
+	hits++;
+	return true;
+}
+
+void NerResultCache::Insert(hash_t key, const char *text, idx_t text_len, const vector<ner_entity> &entities) {
+	const idx_t i = GetShard(key);
+	if (ShardCapacity(i) == 0) {
+		return;
+	}
+	auto &shard = shards[i];
+	lock_guard<mutex> guard(shard.lock);
+	auto it = shard.index.find(key);
+	if (it != shard.index.end()) {
+		// same text computed concurrently, or a hash collision: keep the latest
+		shard.memory -= it->second->Memory();
+		shard.lru.erase(it->second);
+		shard.index.erase(it);
+	}
+	shard.lru.push_front(Entry {key, std::string(text, text_len), entities});
+	shard.index[key] = shard.lru.begin();
+	shard.memory += shard.lru.front().Memory();
+	// read again under the lock: SetCapacity may have shrunk the shard (or stopped using it) meanwhile
+	Evict(shard, ShardCapacity(i));
+}
+
+void NerResultCache::Evict(Shard &shard, idx_t shard_capacity) {
+	while (shard.lru.size() > shard_capacity) {
+		auto &entry = shard.lru.back();
+		shard.memory -= entry.Memory();
+		shard.index.erase(entry.key);
+		shard.lru.pop_back();
+		evictions++;
+	}
+}
+
+NerCacheStats NerResultCache::GetStats() const {
+	NerCacheStats stats;
+	stats.hits = hits;
+	stats.misses = misses;
+	stats.evictions = evictions;
+	stats.capacity = capacity;
+	for (auto &shard : shards) {
+		lock_guard<mutex> guard(shard.lock);
+		stats.entries += shard.lru.size();
+		stats.memory += shard.memory;
+	}
+	return stats;
+}
+
+} // namespace duckdb
@@ -1,188 +1,1184 @@
 #define DUCKDB_EXTENSION_MAIN
 
 #include "ner_extension.hpp"
+#include "ner_cache.hpp"
 #include "ner_model.hpp"
 #include "default_model.hpp"
 
 #include "duckdb.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/expression_executor_state.hpp"
 #include "duckdb/function/scalar_function.hpp"
+#include "duckdb/function/table_function.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include <duckdb/parser/parsed_data/create_scalar_function_info.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <thread>
+
 namespace duckdb {
 
+//! A loaded model. Local states hold a reference to it, so that a model replaced by SET ner_model_path stays alive
+//! until the queries running on it are done.
+struct NerModel {
+	NerModel(struct ner_ctx *ctx_p, string path_p, idx_t version_p)
+	    : ctx(ctx_p), path(std::move(path_p)), version(version_p) {
+	}
+	~NerModel() {
+		ner_free(ctx);
+	}
+
+	struct ner_ctx *ctx;
+	string path;
+	//! Increases with every model loaded, so that cached results of other models never match
+	idx_t version;
+};
+
+//! A model registered by CALL ner_load_model(name, path). Only the most recently used ones stay resident
+//! (ner_max_models), the others are loaded again from path when a query binds to them.
+struct NerNamedModel {
+	string path;
+	//! Empty while not resident
+	shared_ptr<NerModel> model;
+	idx_t last_used = 0;
+};
+
+//! A background load started by SET ner_model_path
+struct NerModelLoader {
+	std::thread thread;
+	shared_ptr<std::atomic<bool>> done;
+};
+
 struct NerGlobalState {
-	struct ner_ctx *ctx = nullptr;
-	std::string model_path;
-	bool is_default = false;
+	~NerGlobalState() {
+		for (auto &loader : loaders) {
+			loader.thread.join();
+		}
+	}
+
+	// Guards the fields below. Never held while a model loads: only to swap models or to read the current one.
+	mutex lock;
+	std::condition_variable model_loaded;
+	shared_ptr<NerModel> model;
+	idx_t n_versions = 0;
+	//! Loads requested by SET ner_model_path; only the latest one is installed
+	idx_t n_requests = 0;
+	string loading_path;
+	string load_error;
+	//! Set when the latest load failed, until a query reports it
+	bool load_error_pending = false;
+	vector<NerModelLoader> loaders;
+	//! Named models selected by ner(text, model := name), and the usage clock ordering their residency
+	case_insensitive_map_t<NerNamedModel> named_models;
+	idx_t n_model_uses = 0;
+	idx_t max_models = 4;
+	//! Every model loaded, by path: a file registered under several names (or also used as the current model)
+	//! is loaded once
+	unordered_map<string, weak_ptr<NerModel>> models_by_path;
+
+	// Results of ner() shared by all threads, see ner_cache_size
+	NerResultCache cache;
+	// Counters of ner_stats() on top of those of the model code, see ner_stats_get
+	std::atomic<uint64_t> n_rows {0};
+	std::atomic<uint64_t> n_chunks {0};
+	std::atomic<uint64_t> chunk_ns {0};
 };
 
 static NerGlobalState global_state;
 
-static void LoadModel(const std::string &path) {
-	if (global_state.ctx) {
-		ner_free(global_state.ctx);
-		global_state.ctx = nullptr;
+// Makes ctx the current model. Called with global_state.lock held.
+static void InstallModel(struct ner_ctx *ctx, const string &path) {
+	global_state.model = make_shared_ptr<NerModel>(ctx, path, ++global_state.n_versions);
+	global_state.models_by_path[path] = global_state.model;
+	global_state.model_loaded.notify_all();
+}
+
+// Loads path without holding the lock, then installs it unless a newer load was requested meanwhile.
+// On failure the current model keeps serving queries.
+static void LoadModel(const string &path, idx_t request) {
+	auto *ctx = ner_load_from_file(path.c_str());
+	lock_guard<mutex> guard(global_state.lock);
+	if (request != global_state.n_requests) {
+		ner_free(ctx);
+		return;
+	}
+	if (ctx) {
+		InstallModel(ctx, path);
+		global_state.load_error.clear();
+	} else {
+		global_state.load_error = "failed to load model '" + path + "'";
 	}
-	global_state.ctx = ner_load_from_file(path.c_str());
-	global_state.model_path = path;
-	global_state.is_default = false;
+	global_state.load_error_pending = !ctx;
+	global_state.loading_path.clear();
+	global_state.model_loaded.notify_all();
 }
 
-static void LoadDefaultModel() {
-	if (global_state.ctx) {
-		ner_free(global_state.ctx);
-		global_state.ctx = nullptr;
+// Starts loading path in the background; queries keep running on the current model until it is swapped in.
+// Without threads (DuckDB-Wasm), the model is loaded synchronously.
+static void RequestModel(const string &path) {
+	std::unique_lock<mutex> guard(global_state.lock);
+	auto request = ++global_state.n_requests;
+	global_state.loading_path = path;
+	global_state.load_error_pending = false;
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+	guard.unlock();
+	LoadModel(path, request);
+#else
+	auto &loaders = global_state.loaders;
+	for (idx_t i = loaders.size(); i-- > 0;) {
+		if (*loaders[i].done) {
+			loaders[i].thread.join();
+			loaders.erase(loaders.begin() + NumericCast<int64_t>(i));
+		}
 	}
-	global_state.ctx = ner_load_from_memory(DEFAULT_MODEL_DATA, DEFAULT_MODEL_SIZE);
-	global_state.model_path = "bundled_tiny_model";
-	global_state.is_default = true;
+	auto done = make_shared_ptr<std::atomic<bool>>(false);
+	std::thread thread([path, request, done]() {
+		LoadModel(path, request);
+		*done = true;
+	});
+	loaders.push_back({std::move(thread), done});
+#endif
 }
 
-struct Entity {
-	std::string text;
-	std::string label;
-};
+// The current model, waiting for a pending load if there is none yet and falling back to the bundled model.
+// The first query bound after a failed load reports its error; the following ones run on the current model.
+static shared_ptr<NerModel> GetModel() {
+	std::unique_lock<mutex> guard(global_state.lock);
+	global_state.model_loaded.wait(guard, []() { return global_state.model || global_state.loading_path.empty(); });
+	if (global_state.load_error_pending) {
+		global_state.load_error_pending = false;
+		throw InvalidInputException("ner_model_path: %s, queries keep running on the current model",
+		                            global_state.load_error);
+	}
+	if (!global_state.model) {
+		auto *ctx = ner_load_from_memory(DEFAULT_MODEL_DATA, DEFAULT_MODEL_SIZE);
+		if (ctx) {
+			InstallModel(ctx, "bundled_tiny_model");
+		}
+	}
+	return global_state.model;
+}
 
-inline void NerScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
-	auto &input_vector = args.data[0];
-	auto count = args.size();
+// Drops the least recently used named models until at most max_models are resident. Queries bound to an evicted
+// model keep it alive until they are done. Called with global_state.lock held.
+static void EvictNamedModels() {
+	while (true) {
+		idx_t n_resident = 0;
+		NerNamedModel *oldest = nullptr;
+		for (auto &entry : global_state.named_models) {
+			auto &named = entry.second;
+			if (named.model) {
+				n_resident++;
+				if (!oldest || named.last_used < oldest->last_used) {
+					oldest = &named;
+				}
+			}
+		}
+		if (n_resident <= global_state.max_models) {
+			return;
+		}
+		oldest->model.reset();
+	}
+}
 
-	bool truncate_opt = true; // Default to true as per prompt "truncate=true instructs to silently truncate"
-	if (args.ColumnCount() > 1) {
-		UnifiedVectorFormat trunc_data;
-		args.data[1].ToUnifiedFormat(count, trunc_data);
-		auto trunc_vals = UnifiedVectorFormat::GetData<bool>(trunc_data);
-		if (trunc_data.validity.RowIsValid(trunc_data.sel->get_index(0))) {
-			truncate_opt = trunc_vals[trunc_data.sel->get_index(0)];
+// The model loaded from path, reusing the one already in memory if there is one. Returns nothing if it fails to load.
+static shared_ptr<NerModel> OpenModel(const string &path) {
+	{
+		lock_guard<mutex> guard(global_state.lock);
+		auto model = global_state.models_by_path[path].lock();
+		if (model) {
+			return model;
 		}
 	}
+	// Load without the lock, like LoadModel
+	auto *ctx = ner_load_from_file(path.c_str());
+	if (!ctx) {
+		return nullptr;
+	}
+	lock_guard<mutex> guard(global_state.lock);
+	auto &slot = global_state.models_by_path[path];
+	auto model = slot.lock();
+	if (model) {
+		// loaded concurrently
+		ner_free(ctx);
+		return model;
+	}
+	for (auto it = global_state.models_by_path.begin(); it != global_state.models_by_path.end();) {
+		it = it->second.expired() && it->first != path ? global_state.models_by_path.erase(it) : std::next(it);
+	}
+	model = make_shared_ptr<NerModel>(ctx, path, ++global_state.n_versions);
+	slot = model;
+	return model;
+}
 
-	// Lazy load default model if none loaded
-	if (!global_state.ctx) {
-		LoadDefaultModel();
+// Registers (or replaces) the model name, loading it right away
+static void RegisterNamedModel(const string &name, const string &path) {
+	auto model = OpenModel(path);
+	if (!model) {
+		throw IOException("ner_load_model: failed to load model '%s'", path);
 	}
+	lock_guard<mutex> guard(global_state.lock);
+	auto &named = global_state.named_models[name];
+	named.path = path;
+	named.model = std::move(model);
+	named.last_used = ++global_state.n_model_uses;
+	EvictNamedModels();
+}
 
-	if (!global_state.ctx) {
-		ListVector::SetListSize(result, 0);
-		result.SetVectorType(VectorType::FLAT_VECTOR);
-		auto result_data = FlatVector::GetData<list_entry_t>(result);
-		for (size_t i = 0; i < count; i++) {
-			result_data[i] = {0, 0};
+// The model registered as name, loaded again if it was evicted
+static shared_ptr<NerModel> GetNamedModel(const string &function, const string &name) {
+	string path;
+	{
+		lock_guard<mutex> guard(global_state.lock);
+		auto it = global_state.named_models.find(name);
+		if (it == global_state.named_models.end()) {
+			throw BinderException("%s: unknown model '%s', register it with CALL ner_load_model('%s', path)", function,
+			                      name, name);
 		}
+		it->second.last_used = ++global_state.n_model_uses;
+		if (it->second.model) {
+			return it->second.model;
+		}
+		path = it->second.path;
+	}
+	auto model = OpenModel(path);
+	if (!model) {
+		throw IOException("%s: failed to load model '%s' from '%s'", function, name, path);
+	}
+	lock_guard<mutex> guard(global_state.lock);
+	auto it = global_state.named_models.find(name);
+	if (it != global_state.named_models.end() && it->second.path == path) {
+		it->second.model = model;
+		EvictNamedModels();
+	}
+	return model;
+}
+
+//! Options of a ner() call, passed positionally (truncate) or by name (truncate, mode, stride, min_score, model,
+//! prefilter)
+struct NerBindData : public FunctionData {
+	//! Silently truncate inputs longer than the model window (mode 'truncate')
+	bool truncate = true;
+	//! Evaluate long inputs as overlapping windows (mode 'window')
+	bool window = false;
+	//! Number of tokens shared by consecutive windows
+	int32_t stride = 128;
+	//! Entities scoring less are dropped. Applied to the decoded (and cached) entities, so it is not part of their key.
+	float min_score = 0.0f;
+	//! Skip the model for texts ner_prefilter finds free of entities (prefilter 'auto'). Texts that pass get the
+	//! same entities as without it, so it is not part of the cache keys either.
+	bool prefilter = false;
+	//! Model registered by ner_load_model, empty for the current model (ner_model_path)
+	string model_name;
+	//! Model serving the call, resolved once at bind time: every thread of the query runs it, even if another
+	//! model is swapped in meanwhile
+	shared_ptr<NerModel> model;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<NerBindData>(*this);
+	}
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<NerBindData>();
+		return truncate == other.truncate && window == other.window && stride == other.stride &&
+		       min_score == other.min_score && prefilter == other.prefilter && model_name == other.model_name &&
+		       model == other.model;
+	}
+};
+
+// Applies the named option name := value of function to data
+static void SetNerOption(NerBindData &data, const string &function, const string &name, const Value &value) {
+	if (value.IsNull()) {
 		return;
 	}
+	if (name == "truncate") {
+		data.truncate = BooleanValue::Get(value.DefaultCastAs(LogicalType::BOOLEAN));
+	} else if (name == "mode") {
+		auto mode = StringUtil::Lower(value.ToString());
+		if (mode != "truncate" && mode != "window") {
+			throw BinderException("%s: mode must be 'truncate' or 'window', got '%s'", function, mode);
+		}
+		data.window = mode == "window";
+	} else if (name == "stride") {
+		data.stride = IntegerValue::Get(value.DefaultCastAs(LogicalType::INTEGER));
+		if (data.stride < 0) {
+			throw BinderException("%s: stride must not be negative", function);
+		}
+	} else if (name == "min_score") {
+		data.min_score = FloatValue::Get(value.DefaultCastAs(LogicalType::FLOAT));
+		if (!(data.min_score >= 0.0f && data.min_score <= 1.0f)) {
+			throw BinderException("%s: min_score must be between 0 and 1", function);
+		}
+	} else if (name == "prefilter") {
+		auto prefilter = StringUtil::Lower(value.ToString());
+		if (prefilter != "none" && prefilter != "auto") {
+			throw BinderException("%s: prefilter must be 'none' or 'auto', got '%s'", function, prefilter);
+		}
+		data.prefilter = prefilter == "auto";
+	} else if (name == "model") {
+		data.model_name = value.ToString();
+		data.model = GetNamedModel(function, data.model_name);
+	} else {
+		throw BinderException("%s: unknown argument \"%s\"", function, name);
+	}
+}
 
-	auto &child_vector = ListVector::GetEntry(result);
-	auto &entity_vector = StructVector::GetEntries(child_vector)[0];
-	auto &label_vector = StructVector::GetEntries(child_vector)[1];
+// Binds data to the current model, unless model := named one
+static void BindNerModel(NerBindData &data) {
+	if (!data.model) {
+		data.model = GetModel();
+	}
+}
 
-	list_entry_t *result_data = FlatVector::GetData<list_entry_t>(result);
-	size_t current_offset = 0;
+static unique_ptr<FunctionData> NerBind(ClientContext &context, ScalarFunction &bound_function,
+                                        vector<unique_ptr<Expression>> &arguments) {
+	auto result = make_uniq<NerBindData>();
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		auto &arg = *arguments[i];
+		auto name = StringUtil::Lower(arg.GetAlias());
+		if (name.empty() && i == 1) {
+			// ner(text, truncate)
+			name = "truncate";
+		}
+		if (!arg.IsFoldable()) {
+			throw BinderException("%s: argument \"%s\" must be a constant", bound_function.name, name);
+		}
+		SetNerOption(*result, bound_function.name, name, ExpressionExecutor::EvaluateScalar(context, arg));
+	}
+	BindNerModel(*result);
+	return std::move(result);
+}
 
-	UnifiedVectorFormat input_data;
-	input_vector.ToUnifiedFormat(count, input_data);
-	auto inputs = UnifiedVectorFormat::GetData<string_t>(input_data);
+// ner_tokenize(text) only takes model :=
+static unique_ptr<FunctionData> NerTokenizeBind(ClientContext &context, ScalarFunction &bound_function,
+                                                vector<unique_ptr<Expression>> &arguments) {
+	auto result = make_uniq<NerBindData>();
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		auto &arg = *arguments[i];
+		auto name = StringUtil::Lower(arg.GetAlias());
+		if (name != "model") {
+			throw BinderException("%s: unknown argument \"%s\"", bound_function.name, name);
+		}
+		if (!arg.IsFoldable()) {
+			throw BinderException("%s: argument \"%s\" must be a constant", bound_function.name, name);
+		}
+		SetNerOption(*result, bound_function.name, name, ExpressionExecutor::EvaluateScalar(context, arg));
+	}
+	BindNerModel(*result);
+	return std::move(result);
+}
 
-	int n_labels = ner_n_labels(global_state.ctx);
-	int n_max_tokens = ner_n_max_tokens(global_state.ctx);
+//! Part of a row evaluated as one sequence: the content tokens [start, start + length) of the row
+//! (not counting its [CLS]), wrapped in [CLS] ... [SEP]. Rows only have several segments in window mode.
+struct NerSegment {
+	idx_t row;
+	int32_t start;
+	int32_t length;
+};
 
-	std::vector<float> logits;
+// Each DuckDB thread evaluating ner() gets its own compute arena and scratch buffers,
+// while the model weights are shared between all of them.
+struct NerLocalState : public FunctionLocalState {
+	NerLocalState(shared_ptr<NerModel> model_p, int32_t n_threads_p, idx_t memory_limit)
+	    : model(std::move(model_p)), ctx(model ? model->ctx : nullptr),
+	      model_version(model ? model->version : 0), exec(ner_exec_init(ctx)), n_threads(n_threads_p) {
+		if (ctx) {
+			ner_exec_set_memory_limit(exec, memory_limit);
+			n_labels = ner_n_labels(ctx);
+			n_max_tokens = ner_n_max_tokens(ctx);
+			// Batches hold up to NER_BATCH_TOKENS padded tokens, and always fit one sequence of maximal length.
+			// ner_memory_limit bounds the compute arena they need by splitting them.
+			n_batch_tokens = MaxValue<int32_t>(n_max_tokens, NER_BATCH_TOKENS);
+			batch_tokens.resize(n_batch_tokens);
+			batch_counts.resize(n_batch_tokens);
+			logits.resize(n_batch_tokens * n_labels);
+			for (int32_t type = 0; type < ner_n_label_types(ctx); type++) {
+				label_types.emplace_back(ner_label_type(ctx, type));
+			}
+		}
+	}
+	~NerLocalState() override {
+		ner_exec_free(exec);
+	}
+
+	//! Keeps the model alive while this state uses it, even if another one is loaded meanwhile
+	shared_ptr<NerModel> model;
+	struct ner_ctx *ctx;
+	//! Version of the model, part of the result cache keys
+	idx_t model_version;
+	struct ner_exec *exec;
+	//! Threads ggml may use for one graph compute, on top of DuckDB's own parallelism
+	int32_t n_threads;
+	int32_t n_labels = 0;
+	int32_t n_max_tokens = 0;
+	int32_t n_batch_tokens = 0;
+	//! Names of the entity types, indexed by ner_entity::type
+	std::vector<std::string> label_types;
+
+	//! Tokens of all rows of the current chunk, stored back to back, and their byte ranges in the row's text
 	std::vector<ner_vocab_id> tokens;
-	tokens.resize(n_max_tokens);
-	logits.resize(n_max_tokens * n_labels);
+	std::vector<ner_span> spans;
+	std::vector<idx_t> token_offsets;
+	std::vector<int32_t> token_counts;
+	//! Sequences to evaluate for the current chunk, in evaluation order (by increasing length)
+	std::vector<NerSegment> segments;
+	std::vector<std::vector<ner_entity>> row_entities;
+	//! Cache keys of the rows computed for the current chunk that should be added to the result cache
+	std::vector<hash_t> row_keys;
+	std::vector<bool> row_uncached;
+
+	//! Rows split into several windows: their logits are summed per token, then averaged
+	std::vector<idx_t> window_rows;
+	std::vector<idx_t> window_offsets;
+	std::vector<float> window_logits;
+	std::vector<int32_t> window_counts;
+
+	std::vector<ner_vocab_id> batch_tokens;
+	std::vector<int32_t> batch_counts;
+	std::vector<float> logits;
+};
+
+// Number of threads a single ner() evaluation may use, from the ner_threads setting.
+// 0 shares the cores left over by DuckDB's own threads between them.
+static int32_t GetNerThreads(ClientContext &context) {
+	int64_t n_threads = 1;
+	Value value;
+	if (context.TryGetCurrentSetting("ner_threads", value) && !value.IsNull()) {
+		n_threads = BigIntValue::Get(value);
+	}
+	if (n_threads == 0) {
+		int64_t n_cores = std::thread::hardware_concurrency();
+		int64_t n_workers = TaskScheduler::GetScheduler(context).NumberOfThreads();
+		n_threads = n_cores / MaxValue<int64_t>(n_workers, 1);
+	}
+	return NumericCast<int32_t>(MaxValue<int64_t>(n_threads, 1));
+}
 
-	const char *label_map[] = {"O", "MISC", "MISC", "PER", "PER", "ORG", "ORG", "LOC", "LOC"};
+// Bytes the compute buffers of a single ner() evaluation may use, from the ner_memory_limit setting (0: no limit)
+static idx_t GetNerMemoryLimit(ClientContext &context) {
+	Value value;
+	if (context.TryGetCurrentSetting("ner_memory_limit", value) && !value.IsNull()) {
+		auto limit = DBConfig::ParseMemoryLimit(value.ToString());
+		return limit == DConstants::INVALID_INDEX ? 0 : limit;
+	}
+	return 0;
+}
 
+// The local state of a thread runs the model its function call was bound to
+static unique_ptr<NerLocalState> MakeNerLocalState(ClientContext &context, const FunctionData &bind_data) {
+	return make_uniq<NerLocalState>(bind_data.Cast<NerBindData>().model, GetNerThreads(context),
+	                                GetNerMemoryLimit(context));
+}
+
+static unique_ptr<FunctionLocalState> NerInitLocalState(ExpressionState &state, const BoundFunctionExpression &expr,
+                                                        FunctionData *bind_data) {
+	return MakeNerLocalState(state.GetContext(), *bind_data);
+}
+
+// Decodes the entities of a row from the logits of all its tokens
+static void DecodeRow(NerLocalState &lstate, idx_t row, const float *row_logits) {
+	auto &entities = lstate.row_entities[row];
+	const auto offset = lstate.token_offsets[row];
+	const auto n_tokens = lstate.token_counts[row];
+	entities.resize(n_tokens);
+	auto n_entities = ner_decode(lstate.ctx, lstate.tokens.data() + offset, lstate.spans.data() + offset, n_tokens,
+	                             row_logits, entities.data(), n_tokens);
+	entities.resize(n_entities);
+}
+
+// Evaluates segments[0..n_segments), padded to the longest of them, as one batch.
+// Rows made of a single segment are decoded right away, windows are accumulated into window_logits.
+static void EvaluateBatch(NerLocalState &lstate, const NerSegment *segments, idx_t n_segments, int32_t n_seq) {
+	const auto n_labels = lstate.n_labels;
+	for (idx_t r = 0; r < n_segments; r++) {
+		const auto &segment = segments[r];
+		const auto *row_tokens = lstate.tokens.data() + lstate.token_offsets[segment.row];
+		auto *seq_tokens = lstate.batch_tokens.data() + r * n_seq;
+		seq_tokens[0] = row_tokens[0];
+		memcpy(seq_tokens + 1, row_tokens + 1 + segment.start, segment.length * sizeof(ner_vocab_id));
+		seq_tokens[segment.length + 1] = row_tokens[lstate.token_counts[segment.row] - 1];
+		lstate.batch_counts[r] = segment.length + 2;
+	}
+
+	ner_eval_batch(lstate.exec, lstate.n_threads, lstate.batch_tokens.data(), lstate.batch_counts.data(),
+	               NumericCast<int32_t>(n_segments), n_seq, lstate.logits.data());
+
+	for (idx_t r = 0; r < n_segments; r++) {
+		const auto &segment = segments[r];
+		const float *seq_logits = lstate.logits.data() + r * n_seq * n_labels;
+		if (lstate.token_counts[segment.row] == segment.length + 2) {
+			DecodeRow(lstate, segment.row, seq_logits);
+			continue;
+		}
+		// Row token t (counting [CLS]) is at position t - segment.start of the window
+		auto offset = lstate.window_offsets[segment.row];
+		for (int32_t t = 1; t <= segment.length; t++) {
+			auto row_t = offset + segment.start + t;
+			for (int32_t l = 0; l < n_labels; l++) {
+				lstate.window_logits[row_t * n_labels + l] += seq_logits[t * n_labels + l];
+			}
+			lstate.window_counts[row_t]++;
+		}
+	}
+}
+
+// Finds the entities of the count texts of input_data into lstate.row_entities, NULL texts having none.
+// The whole chunk is tokenized first, so that rows can be packed into batches.
+static void ExtractEntities(NerLocalState &lstate, const NerBindData &bind_data, const UnifiedVectorFormat &input_data,
+                            idx_t count) {
+	auto inputs = UnifiedVectorFormat::GetData<string_t>(input_data);
+	const auto start_time = std::chrono::steady_clock::now();
+
+	const int32_t n_max_tokens = lstate.n_max_tokens;
+	const int32_t n_labels = lstate.n_labels;
+	// Content tokens of a window, i.e. without [CLS] and [SEP]
+	const int32_t n_window = n_max_tokens - 2;
+	if (bind_data.window && bind_data.stride >= n_window) {
+		throw InvalidInputException("ner: stride (%d) must be smaller than the model window (%d tokens)",
+		                            bind_data.stride, n_window);
+	}
+
+	// Cached results depend on the model and on every option of the call
+	auto &cache = global_state.cache;
+	hash_t options_key = CombineHash(Hash(lstate.model_version), Hash(bind_data.truncate));
+	options_key = CombineHash(options_key, CombineHash(Hash(bind_data.window), Hash(bind_data.stride)));
+
+	lstate.tokens.clear();
+	lstate.spans.clear();
+	lstate.token_offsets.resize(count);
+	lstate.token_counts.resize(count);
+	lstate.segments.clear();
+	lstate.row_entities.resize(count);
+	lstate.row_keys.resize(count);
+	lstate.row_uncached.assign(count, false);
+	lstate.window_rows.clear();
+	lstate.window_offsets.resize(count);
+	lstate.window_logits.clear();
+	lstate.window_counts.clear();
 	for (size_t i = 0; i < count; i++) {
+		lstate.row_entities[i].clear();
 		auto idx = input_data.sel->get_index(i);
 		if (!input_data.validity.RowIsValid(idx)) {
-			FlatVector::SetNull(result, i, true);
 			continue;
 		}
 
-		auto input_str = inputs[idx].GetString();
-		result_data[i].offset = current_offset;
+		const auto &input = inputs[idx];
+		if (bind_data.prefilter && !ner_prefilter(lstate.ctx, input.GetData(), input.GetSize())) {
+			continue;
+		}
+		if (cache.Admits(input.GetSize())) {
+			auto key = CombineHash(options_key, Hash(input.GetData(), input.GetSize()));
+			if (cache.Lookup(key, input.GetData(), input.GetSize(), lstate.row_entities[i])) {
+				continue;
+			}
+			lstate.row_keys[i] = key;
+			lstate.row_uncached[i] = true;
+		}
 
+		// Tokenize straight from the vector memory into the chunk's token buffer. Windowed rows are never
+		// truncated: every token consumes at least one byte of input.
+		const int32_t n_capacity =
+		    bind_data.window ? NumericCast<int32_t>(input.GetSize() + 2) : MaxValue<int32_t>(n_max_tokens, 2);
+		auto offset = lstate.tokens.size();
+		lstate.tokens.resize(offset + n_capacity);
+		lstate.spans.resize(offset + n_capacity);
 		int32_t n_tokens = 0;
-		ner_tokenize(global_state.ctx, input_str.c_str(), tokens.data(), &n_tokens, n_max_tokens);
+		const bool truncated =
+		    ner_tokenize_spans(lstate.ctx, input.GetData(), input.GetSize(), lstate.tokens.data() + offset,
+		                       lstate.spans.data() + offset, &n_tokens, n_capacity);
+		lstate.tokens.resize(offset + n_tokens);
+		lstate.spans.resize(offset + n_tokens);
 
-		// Simple heuristic: if we used exactly n_max_tokens, it might have been truncated.
-		if (!truncate_opt && n_tokens >= n_max_tokens) {
+		if (truncated && !bind_data.truncate) {
 			throw InvalidInputException("Input string exceeds model token limit and truncate=false");
 		}
 
-		ner_eval(global_state.ctx, 4, tokens.data(), n_tokens, logits.data());
+		lstate.token_offsets[i] = offset;
+		lstate.token_counts[i] = n_tokens;
+
+		const int32_t n_content = n_tokens - 2;
+		if (n_content <= n_window) {
+			lstate.segments.push_back({i, 0, n_content});
+			continue;
+		}
+		// Overlapping windows of n_window tokens, the last one aligned with the end of the row
+		const int32_t step = n_window - bind_data.stride;
+		for (int32_t start = 0;; start += step) {
+			start = MinValue<int32_t>(start, n_content - n_window);
+			lstate.segments.push_back({i, start, n_window});
+			if (start + n_window >= n_content) {
+				break;
+			}
+		}
+		lstate.window_rows.push_back(i);
+		lstate.window_offsets[i] = lstate.window_counts.size();
+		lstate.window_counts.resize(lstate.window_counts.size() + n_tokens, 0);
+		lstate.window_logits.resize(lstate.window_counts.size() * n_labels, 0.0f);
+	}
 
-		std::vector<Entity> entities;
-		Entity current_entity;
-		int last_label_type = 0; // 0: O, 1: MISC, 2: PER, 3: ORG, 4: LOC
+	// Sort the segments by length, so that short rows are not padded to the length of long ones sharing their batch.
+	// Results are scattered back by row, so the evaluation order does not matter.
+	auto &segments = lstate.segments;
+	std::stable_sort(segments.begin(), segments.end(),
+	                 [](const NerSegment &a, const NerSegment &b) { return a.length < b.length; });
 
-		for (int t = 0; t < n_tokens; t++) {
-			int best_label = 0;
-			float max_logit = -1e10;
-			for (int l = 0; l < n_labels; l++) {
-				if (logits[t * n_labels + l] > max_logit) {
-					max_logit = logits[t * n_labels + l];
-					best_label = l;
-				}
+	// Greedily pack consecutive segments into batches of at most n_batch_tokens tokens, once padded to their
+	// length bucket
+	for (idx_t begin = 0; begin < segments.size();) {
+		idx_t end = begin;
+		int32_t n_seq = 0;
+		while (end < segments.size()) {
+			auto n_seq_new = MaxValue<int32_t>(n_seq, segments[end].length + 2);
+			auto n_padded = ner_seq_bucket(lstate.ctx, n_seq_new);
+			if (end > begin && NumericCast<int64_t>(end - begin + 1) * n_padded > lstate.n_batch_tokens) {
+				break;
 			}
+			n_seq = n_seq_new;
+			end++;
+		}
+		EvaluateBatch(lstate, segments.data() + begin, end - begin, n_seq);
+		begin = end;
+	}
 
-			std::string token_str = ner_vocab_id_to_token(global_state.ctx, tokens[t]);
-			if (token_str == "[CLS]" || token_str == "[SEP]") {
-				continue;
+	// Average the logits of tokens covered by several windows, then decode the whole row at once
+	for (auto row : lstate.window_rows) {
+		auto offset = lstate.window_offsets[row];
+		auto *row_logits = lstate.window_logits.data() + offset * n_labels;
+		for (int32_t t = 0; t < lstate.token_counts[row]; t++) {
+			auto n = lstate.window_counts[offset + t];
+			for (int32_t l = 0; n > 1 && l < n_labels; l++) {
+				row_logits[t * n_labels + l] /= static_cast<float>(n);
 			}
+		}
+		DecodeRow(lstate, row, row_logits);
+	}
 
-			bool is_subword = (token_str.size() > 2 && token_str[0] == '#' && token_str[1] == '#');
-			std::string clean_token = is_subword ? token_str.substr(2) : token_str;
+	for (idx_t i = 0; i < count; i++) {
+		if (lstate.row_uncached[i]) {
+			const auto &input = inputs[input_data.sel->get_index(i)];
+			cache.Insert(lstate.row_keys[i], input.GetData(), input.GetSize(), lstate.row_entities[i]);
+		}
+	}
 
-			int label_type = (best_label + 1) / 2; // Maps B-X and I-X to same group
-			if (best_label == 0) {
-				label_type = 0;
-			}
+	auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time);
+	global_state.n_rows.fetch_add(count, std::memory_order_relaxed);
+	global_state.n_chunks.fetch_add(1, std::memory_order_relaxed);
+	global_state.chunk_ns.fetch_add(NumericCast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+}
 
-			if (label_type != 0) {
-				if (label_type == last_label_type && (best_label % 2 == 0 || is_subword)) {
-					// Continue current entity
-					current_entity.text += (is_subword ? "" : " ") + clean_token;
-				} else {
-					// Start new entity
-					if (last_label_type != 0) {
-						entities.push_back(current_entity);
-					}
-					current_entity.text = clean_token;
-					current_entity.label = label_map[best_label];
-				}
-			} else {
-				if (last_label_type != 0) {
-					entities.push_back(current_entity);
-				}
-			}
-			last_label_type = label_type;
+// Converts increasing byte offsets of a UTF-8 text into 0-based character offsets
+struct NerCharCursor {
+	const char *text = nullptr;
+	int32_t byte = 0;
+	int64_t chars = 0;
+
+	void Reset(const char *text_p) {
+		text = text_p;
+		byte = 0;
+		chars = 0;
+	}
+	int64_t Seek(int32_t target) {
+		for (; byte < target; byte++) {
+			chars += (static_cast<uint8_t>(text[byte]) & 0xC0) != 0x80;
 		}
-		if (last_label_type != 0) {
-			entities.push_back(current_entity);
+		return chars;
+	}
+};
+
+inline void NerScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &input_vector = args.data[0];
+	auto count = args.size();
+
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &bind_data = func_expr.bind_info->Cast<NerBindData>();
+
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<NerLocalState>();
+	if (!lstate.ctx) {
+		ListVector::SetListSize(result, 0);
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		auto result_data = FlatVector::GetData<list_entry_t>(result);
+		for (size_t i = 0; i < count; i++) {
+			result_data[i] = {0, 0};
+		}
+		return;
+	}
+
+	UnifiedVectorFormat input_data;
+	input_vector.ToUnifiedFormat(count, input_data);
+	auto inputs = UnifiedVectorFormat::GetData<string_t>(input_data);
+	ExtractEntities(lstate, bind_data, input_data, count);
+
+	auto &child_vector = ListVector::GetEntry(result);
+	auto &fields = StructVector::GetEntries(child_vector);
+	auto &entity_vector = *fields[0];
+	auto &label_vector = *fields[1];
+
+	list_entry_t *result_data = FlatVector::GetData<list_entry_t>(result);
+	size_t current_offset = 0;
+	NerCharCursor cursor;
+	for (size_t i = 0; i < count; i++) {
+		auto idx = input_data.sel->get_index(i);
+		if (!input_data.validity.RowIsValid(idx)) {
+			FlatVector::SetNull(result, i, true);
+			continue;
 		}
 
+		// Entity texts are sliced straight from the input, and their byte ranges converted to character offsets
+		const char *text = inputs[idx].GetData();
+		const auto &entities = lstate.row_entities[i];
+		cursor.Reset(text);
+		result_data[i].offset = current_offset;
+		ListVector::Reserve(result, current_offset + entities.size());
+		auto entity_data = FlatVector::GetData<string_t>(entity_vector);
+		auto label_data = FlatVector::GetData<string_t>(label_vector);
+		auto start_data = FlatVector::GetData<int64_t>(*fields[2]);
+		auto end_data = FlatVector::GetData<int64_t>(*fields[3]);
+		auto score_data = FlatVector::GetData<float>(*fields[4]);
 		for (const auto &ent : entities) {
-			ListVector::Reserve(result, current_offset + 1);
-			FlatVector::GetData<string_t>(*entity_vector)[current_offset] =
-			    StringVector::AddString(*entity_vector, ent.text);
-			FlatVector::GetData<string_t>(*label_vector)[current_offset] =
-			    StringVector::AddString(*label_vector, ent.label);
+			if (ent.score < bind_data.min_score) {
+				continue;
+			}
+			entity_data[current_offset] =
+			    StringVector::AddString(entity_vector, text + ent.start, NumericCast<idx_t>(ent.end - ent.start));
+			label_data[current_offset] = StringVector::AddString(label_vector, lstate.label_types[ent.type]);
+			start_data[current_offset] = cursor.Seek(ent.start);
+			end_data[current_offset] = cursor.Seek(ent.end);
+			score_data[current_offset] = ent.score;
 			current_offset++;
 		}
-		result_data[i].length = entities.size();
+		result_data[i].length = current_offset - result_data[i].offset;
+	}
+	ListVector::SetListSize(result, current_offset);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+}
+
+// ner_tokenize(text): the WordPiece token ids the model sees for text, including [CLS] and [SEP]
+static void NerTokenizeFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &input_vector = args.data[0];
+	auto count = args.size();
+
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<NerLocalState>();
+
+	UnifiedVectorFormat input_data;
+	input_vector.ToUnifiedFormat(count, input_data);
+	auto inputs = UnifiedVectorFormat::GetData<string_t>(input_data);
+
+	auto result_data = FlatVector::GetData<list_entry_t>(result);
+	auto &child_vector = ListVector::GetEntry(result);
+	idx_t current_offset = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = input_data.sel->get_index(i);
+		if (!input_data.validity.RowIsValid(idx)) {
+			FlatVector::SetNull(result, i, true);
+			continue;
+		}
+		int32_t n_tokens = 0;
+		if (lstate.ctx) {
+			const auto &input = inputs[idx];
+			ListVector::Reserve(result, current_offset + lstate.n_max_tokens);
+			ner_tokenize(lstate.ctx, input.GetData(), input.GetSize(),
+			             FlatVector::GetData<int32_t>(child_vector) + current_offset, &n_tokens, lstate.n_max_tokens);
+		}
+		result_data[i].offset = current_offset;
+		result_data[i].length = n_tokens;
+		current_offset += n_tokens;
 	}
 	ListVector::SetListSize(result, current_offset);
 	result.SetVectorType(VectorType::FLAT_VECTOR);
 }
 
+// ner_scan((SELECT row_id, text ...)): one row per entity, without building nested lists.
+// Each DuckDB thread runs the whole tokenize -> batched eval -> decode pipeline on the chunks it is given.
+struct NerScanLocalState : public LocalTableFunctionState {
+	unique_ptr<NerLocalState> ner;
+	//! Texts of the current input chunk, whose entities are in ner->row_entities
+	UnifiedVectorFormat text_data;
+	bool extracted = false;
+	//! Next entity to emit
+	idx_t row = 0;
+	idx_t entity = 0;
+	NerCharCursor cursor;
+};
+
+static unique_ptr<FunctionData> NerScanBind(ClientContext &context, TableFunctionBindInput &input,
+                                            vector<LogicalType> &return_types, vector<string> &names) {
+	if (input.input_table_types.size() != 2 || input.input_table_types[1].id() != LogicalTypeId::VARCHAR) {
+		throw BinderException("ner_scan: expects a subquery of two columns, a row id and a VARCHAR text");
+	}
+	auto result = make_uniq<NerBindData>();
+	for (auto &param : input.named_parameters) {
+		SetNerOption(*result, "ner_scan", StringUtil::Lower(param.first), param.second);
+	}
+	BindNerModel(*result);
+	names = {input.input_table_names[0], "entity", "label", "start", "end", "score"};
+	return_types = {input.input_table_types[0], LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::BIGINT,
+	                LogicalType::BIGINT, LogicalType::FLOAT};
+	return std::move(result);
+}
+
+static unique_ptr<LocalTableFunctionState> NerScanInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                            GlobalTableFunctionState *global_state_p) {
+	auto result = make_uniq<NerScanLocalState>();
+	result->ner = MakeNerLocalState(context.client, *input.bind_data);
+	return std::move(result);
+}
+
+static OperatorResultType NerScanFun(ExecutionContext &context, TableFunctionInput &data_p, DataChunk &input,
+                                     DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<NerBindData>();
+	auto &state = data_p.local_state->Cast<NerScanLocalState>();
+	auto &lstate = *state.ner;
+	if (!lstate.ctx) {
+		output.SetCardinality(0);
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+	if (!state.extracted) {
+		input.data[1].ToUnifiedFormat(input.size(), state.text_data);
+		ExtractEntities(lstate, bind_data, state.text_data, input.size());
+		state.extracted = true;
+		state.row = 0;
+		state.entity = 0;
+	}
+
+	// Emit entities until the output chunk is full; the input chunk stays the same until NEED_MORE_INPUT
+	auto inputs = UnifiedVectorFormat::GetData<string_t>(state.text_data);
+	auto entity_data = FlatVector::GetData<string_t>(output.data[1]);
+	auto label_data = FlatVector::GetData<string_t>(output.data[2]);
+	auto start_data = FlatVector::GetData<int64_t>(output.data[3]);
+	auto end_data = FlatVector::GetData<int64_t>(output.data[4]);
+	auto score_data = FlatVector::GetData<float>(output.data[5]);
+	SelectionVector rows(STANDARD_VECTOR_SIZE);
+	idx_t n_output = 0;
+	while (state.row < input.size() && n_output < STANDARD_VECTOR_SIZE) {
+		const auto &entities = lstate.row_entities[state.row];
+		if (state.entity == entities.size()) {
+			state.row++;
+			state.entity = 0;
+			continue;
+		}
+		const char *text = inputs[state.text_data.sel->get_index(state.row)].GetData();
+		if (state.entity == 0) {
+			state.cursor.Reset(text);
+		}
+		const auto &ent = entities[state.entity++];
+		if (ent.score < bind_data.min_score) {
+			continue;
+		}
+		rows.set_index(n_output, state.row);
+		entity_data[n_output] =
+		    StringVector::AddString(output.data[1], text + ent.start, NumericCast<idx_t>(ent.end - ent.start));
+		label_data[n_output] = StringVector::AddString(output.data[2], lstate.label_types[ent.type]);
+		start_data[n_output] = state.cursor.Seek(ent.start);
+		end_data[n_output] = state.cursor.Seek(ent.end);
+		score_data[n_output] = ent.score;
+		n_output++;
+	}
+	VectorOperations::Copy(input.data[0], output.data[0], rows, n_output, 0, 0);
+	output.SetCardinality(n_output);
+
+	if (state.row < input.size()) {
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+	state.extracted = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+static void SetNerThreads(ClientContext &context, SetScope scope, Value &parameter) {
+	if (!parameter.IsNull() && BigIntValue::Get(parameter) < 0) {
+		throw InvalidInputException("ner_threads must be 0 (automatic) or a positive number of threads");
+	}
+}
+
+static void SetNerMemoryLimit(ClientContext &context, SetScope scope, Value &parameter) {
+	if (!parameter.IsNull()) {
+		// throws on malformed limits
+		DBConfig::ParseMemoryLimit(parameter.ToString());
+	}
+}
+
+static void SetNerCacheSize(ClientContext &context, SetScope scope, Value &parameter) {
+	auto size = parameter.IsNull() ? 0 : BigIntValue::Get(parameter);
+	if (size < 0) {
+		throw InvalidInputException("ner_cache_size must be 0 (disabled) or a positive number of texts");
+	}
+	global_state.cache.SetCapacity(NumericCast<idx_t>(size));
+}
+
+static void SetNerCacheMaxTextLength(ClientContext &context, SetScope scope, Value &parameter) {
+	auto length = parameter.IsNull() ? 0 : BigIntValue::Get(parameter);
+	if (length < 0) {
+		throw InvalidInputException("ner_cache_max_text_length must not be negative");
+	}
+	global_state.cache.SetMaxTextLength(NumericCast<idx_t>(length));
+}
+
+// ner_cache_stats(): counters of the ner() result cache
+struct NerCacheStatsState : public GlobalTableFunctionState {
+	bool done = false;
+};
+
+static unique_ptr<FunctionData> NerCacheStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                  vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"hits", "misses", "evictions", "entries", "capacity", "memory_bytes"};
+	return_types.assign(names.size(), LogicalType::UBIGINT);
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> NerCacheStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<NerCacheStatsState>();
+}
+
+static void NerCacheStatsFun(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<NerCacheStatsState>();
+	if (state.done) {
+		return;
+	}
+	auto stats = global_state.cache.GetStats();
+	idx_t col = 0;
+	for (auto value : {stats.hits, stats.misses, stats.evictions, stats.entries, stats.capacity, stats.memory}) {
+		output.SetValue(col++, 0, Value::UBIGINT(value));
+	}
+	output.SetCardinality(1);
+	state.done = true;
+}
+
+// ner_stats(): one (name, value) row per counter of the extension and of the model code, histogram buckets being
+// named after their range, e.g. compute_us[512, 1024)
+struct NerStatsState : public GlobalTableFunctionState {
+	vector<pair<string, uint64_t>> stats;
+	idx_t offset = 0;
+};
+
+static unique_ptr<FunctionData> NerStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                             vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"name", "value"};
+	return_types = {LogicalType::VARCHAR, LogicalType::UBIGINT};
+	return make_uniq<TableFunctionData>();
+}
+
+static void AddNerHistogram(vector<pair<string, uint64_t>> &stats, const string &name, const uint64_t *buckets) {
+	for (idx_t i = 0; i < NER_STATS_HIST_BUCKETS; i++) {
+		if (buckets[i] == 0) {
+			continue;
+		}
+		auto low = i == 0 ? 0 : uint64_t(1) << (i - 1);
+		auto high = uint64_t(1) << i;
+		auto range = "[" + std::to_string(low) + ", " + (i + 1 == NER_STATS_HIST_BUCKETS ? "" : std::to_string(high)) + ")";
+		stats.emplace_back(name + range, buckets[i]);
+	}
+}
+
+static unique_ptr<GlobalTableFunctionState> NerStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<NerStatsState>();
+	ner_stats model_stats;
+	ner_stats_get(&model_stats);
+	auto &stats = result->stats;
+	stats.emplace_back("rows", global_state.n_rows.load());
+	stats.emplace_back("chunks", global_state.n_chunks.load());
+	stats.emplace_back("chunk_ns", global_state.chunk_ns.load());
+	stats.emplace_back("texts_tokenized", model_stats.n_tokenized);
+	stats.emplace_back("tokens", model_stats.n_tokens);
+	stats.emplace_back("truncations", model_stats.n_truncated);
+	stats.emplace_back("unknown_bytes", model_stats.n_unknown);
+	stats.emplace_back("tokenize_ns", model_stats.tokenize_ns);
+	stats.emplace_back("prefilter_texts", model_stats.n_prefiltered);
+	stats.emplace_back("prefilter_skipped", model_stats.n_prefilter_skip);
+	stats.emplace_back("prefilter_ns", model_stats.prefilter_ns);
+	stats.emplace_back("graph_builds", model_stats.n_graph_builds);
+	stats.emplace_back("graph_build_ns", model_stats.graph_build_ns);
+	stats.emplace_back("computes", model_stats.n_computes);
+	stats.emplace_back("sequences", model_stats.n_sequences);
+	stats.emplace_back("padded_tokens", model_stats.n_padded_tokens);
+	stats.emplace_back("compute_ns", model_stats.compute_ns);
+	stats.emplace_back("sequences_decoded", model_stats.n_decoded);
+	stats.emplace_back("entities", model_stats.n_entities);
+	stats.emplace_back("decode_ns", model_stats.decode_ns);
+	stats.emplace_back("arena_high_water_bytes", model_stats.arena_high_water);
+	AddNerHistogram(stats, "compute_us", model_stats.compute_us_hist);
+	AddNerHistogram(stats, "batch_tokens", model_stats.batch_tokens_hist);
+	return std::move(result);
+}
+
+static void NerStatsFun(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<NerStatsState>();
+	idx_t count = 0;
+	for (; state.offset < state.stats.size() && count < STANDARD_VECTOR_SIZE; state.offset++, count++) {
+		auto &stat = state.stats[state.offset];
+		output.SetValue(0, count, Value(stat.first));
+		output.SetValue(1, count, Value::UBIGINT(stat.second));
+	}
+	output.SetCardinality(count);
+}
+
+// CALL ner_stats_reset(): zeroes the counters of ner_stats()
+struct NerStatsResetState : public GlobalTableFunctionState {
+	bool done = false;
+};
+
+static unique_ptr<FunctionData> NerStatsResetBind(ClientContext &context, TableFunctionBindInput &input,
+                                                  vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"Success"};
+	return_types = {LogicalType::BOOLEAN};
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> NerStatsResetInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<NerStatsResetState>();
+}
+
+static void NerStatsResetFun(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<NerStatsResetState>();
+	if (state.done) {
+		return;
+	}
+	ner_stats_reset();
+	global_state.n_rows = 0;
+	global_state.n_chunks = 0;
+	global_state.chunk_ns = 0;
+	output.SetValue(0, 0, Value::BOOLEAN(true));
+	output.SetCardinality(1);
+	state.done = true;
+}
+
 static void SetNerModelPath(ClientContext &context, SetScope scope, Value &parameter) {
+	// Fail the SET itself for a missing file: other errors are only known once the model is loaded
 	auto path = parameter.ToString();
-	LoadModel(path);
+	if (!FileSystem::GetFileSystem(context).FileExists(path)) {
+		throw InvalidInputException("ner_model_path: model file '%s' does not exist", path);
+	}
+	RequestModel(path);
+}
+
+// ner_model_info(): the model serving queries, and the state of the last SET ner_model_path
+struct NerModelInfoState : public GlobalTableFunctionState {
+	bool done = false;
+};
+
+static unique_ptr<FunctionData> NerModelInfoBind(ClientContext &context, TableFunctionBindInput &input,
+                                                 vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"path", "version", "loading", "error"};
+	return_types = {LogicalType::VARCHAR, LogicalType::UBIGINT, LogicalType::VARCHAR, LogicalType::VARCHAR};
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> NerModelInfoInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<NerModelInfoState>();
+}
+
+static void NerModelInfoFun(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<NerModelInfoState>();
+	if (state.done) {
+		return;
+	}
+	lock_guard<mutex> guard(global_state.lock);
+	auto &model = global_state.model;
+	output.SetValue(0, 0, model ? Value(model->path) : Value());
+	output.SetValue(1, 0, model ? Value::UBIGINT(model->version) : Value());
+	output.SetValue(2, 0, global_state.loading_path.empty() ? Value() : Value(global_state.loading_path));
+	output.SetValue(3, 0, global_state.load_error.empty() ? Value() : Value(global_state.load_error));
+	output.SetCardinality(1);
+	state.done = true;
+}
+
+static void SetNerMaxModels(ClientContext &context, SetScope scope, Value &parameter) {
+	auto max_models = parameter.IsNull() ? 4 : BigIntValue::Get(parameter);
+	if (max_models < 1) {
+		throw InvalidInputException("ner_max_models must be at least 1");
+	}
+	lock_guard<mutex> guard(global_state.lock);
+	global_state.max_models = NumericCast<idx_t>(max_models);
+	EvictNamedModels();
+}
+
+// CALL ner_load_model(name, path): registers the model file path as name, for ner(text, model := name)
+struct NerLoadModelData : public TableFunctionData {
+	string name;
+	string path;
+};
+
+struct NerLoadModelState : public GlobalTableFunctionState {
+	bool done = false;
+};
+
+static unique_ptr<FunctionData> NerLoadModelBind(ClientContext &context, TableFunctionBindInput &input,
+                                                 vector<LogicalType> &return_types, vector<string> &names) {
+	for (auto &input_value : input.inputs) {
+		if (input_value.IsNull()) {
+			throw BinderException("ner_load_model: name and path must not be NULL");
+		}
+	}
+	auto result = make_uniq<NerLoadModelData>();
+	result->name = input.inputs[0].ToString();
+	result->path = input.inputs[1].ToString();
+	names = {"Success"};
+	return_types = {LogicalType::BOOLEAN};
+	return std::move(result);
+}
+
+static unique_ptr<GlobalTableFunctionState> NerLoadModelInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<NerLoadModelState>();
+}
+
+static void NerLoadModelFun(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<NerLoadModelData>();
+	auto &state = data_p.global_state->Cast<NerLoadModelState>();
+	if (state.done) {
+		return;
+	}
+	RegisterNamedModel(bind_data.name, bind_data.path);
+	output.SetValue(0, 0, Value::BOOLEAN(true));
+	output.SetCardinality(1);
+	state.done = true;
+}
+
+// ner_models(): the models registered by ner_load_model, and whether they are resident
+struct NerModelsState : public GlobalTableFunctionState {
+	vector<vector<Value>> rows;
+	idx_t offset = 0;
+};
+
+static unique_ptr<FunctionData> NerModelsBind(ClientContext &context, TableFunctionBindInput &input,
+                                              vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"name", "path", "version", "resident"};
+	return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::UBIGINT, LogicalType::BOOLEAN};
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> NerModelsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<NerModelsState>();
+	lock_guard<mutex> guard(global_state.lock);
+	for (auto &entry : global_state.named_models) {
+		auto &model = entry.second.model;
+		result->rows.push_back({Value(entry.first), Value(entry.second.path),
+		                        model ? Value::UBIGINT(model->version) : Value(), Value::BOOLEAN(static_cast<bool>(model))});
+	}
+	std::sort(result->rows.begin(), result->rows.end(),
+	          [](const vector<Value> &a, const vector<Value> &b) { return a[0].ToString() < b[0].ToString(); });
+	return std::move(result);
+}
+
+static void NerModelsFun(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<NerModelsState>();
+	idx_t count = 0;
+	for (; state.offset < state.rows.size() && count < STANDARD_VECTOR_SIZE; state.offset++, count++) {
+		auto &row = state.rows[state.offset];
+		for (idx_t col = 0; col < row.size(); col++) {
+			output.SetValue(col, count, row[col]);
+		}
+	}
+	output.SetCardinality(count);
 }
 
 static void LoadInternal(ExtensionLoader &loader) {
@@ -191,30 +1187,89 @@ static void LoadInternal(ExtensionLoader &loader) {
 	child_list_t<LogicalType> struct_children;
 	struct_children.push_back(make_pair("entity", LogicalType::VARCHAR));
 	struct_children.push_back(make_pair("label", LogicalType::VARCHAR));
+	struct_children.push_back(make_pair("start", LogicalType::BIGINT));
+	struct_children.push_back(make_pair("end", LogicalType::BIGINT));
+	struct_children.push_back(make_pair("score", LogicalType::FLOAT));
 	auto struct_type = LogicalType::STRUCT(struct_children);
 	auto res_type = LogicalType::LIST(struct_type);
 
-	// Register 'ner'
+	// Register 'ner': ner(text[, truncate]) plus the named options truncate := , mode := , stride := , min_score := and
+	// model :=
 	ScalarFunctionSet ner_set("ner");
-	ner_set.AddFunction(ScalarFunction({LogicalType::VARCHAR}, res_type, NerScalarFun));
-	ner_set.AddFunction(ScalarFunction({LogicalType::VARCHAR, LogicalType::BOOLEAN}, res_type, NerScalarFun));
+	ner_set.AddFunction(ScalarFunction({LogicalType::VARCHAR}, res_type, NerScalarFun, NerBind));
 	for (auto &func : ner_set.functions) {
-		func.stability = FunctionStability::VOLATILE;
+		func.varargs = LogicalType::ANY;
+		func.stability = FunctionStability::CONSISTENT_WITHIN_QUERY;
+		func.init_local_state = NerInitLocalState;
 	}
 	loader.RegisterFunction(ner_set);
 
 	// Register 'ner_extract' as alias
 	ScalarFunctionSet ner_extract_set("ner_extract");
-	ner_extract_set.AddFunction(ScalarFunction({LogicalType::VARCHAR}, res_type, NerScalarFun));
-	ner_extract_set.AddFunction(ScalarFunction({LogicalType::VARCHAR, LogicalType::BOOLEAN}, res_type, NerScalarFun));
+	ner_extract_set.AddFunction(ScalarFunction({LogicalType::VARCHAR}, res_type, NerScalarFun, NerBind));
 	for (auto &func : ner_extract_set.functions) {
-		func.stability = FunctionStability::VOLATILE;
+		func.varargs = LogicalType::ANY;
+		func.stability = FunctionStability::CONSISTENT_WITHIN_QUERY;
+		func.init_local_state = NerInitLocalState;
 	}
 	loader.RegisterFunction(ner_extract_set);
 
+	// Register 'ner_tokenize', mostly to measure the tokenizer on its own
+	ScalarFunction ner_tokenize_fun("ner_tokenize", {LogicalType::VARCHAR}, LogicalType::LIST(LogicalType::INTEGER),
+	                                NerTokenizeFun, NerTokenizeBind);
+	ner_tokenize_fun.varargs = LogicalType::ANY;
+	ner_tokenize_fun.stability = FunctionStability::VOLATILE;
+	ner_tokenize_fun.init_local_state = NerInitLocalState;
+	loader.RegisterFunction(ner_tokenize_fun);
+
+	// Register 'ner_scan', streaming one row per entity
+	TableFunction ner_scan_fun("ner_scan", {LogicalType::TABLE}, nullptr, NerScanBind, nullptr, NerScanInitLocal);
+	ner_scan_fun.in_out_function = NerScanFun;
+	ner_scan_fun.named_parameters["truncate"] = LogicalType::BOOLEAN;
+	ner_scan_fun.named_parameters["mode"] = LogicalType::VARCHAR;
+	ner_scan_fun.named_parameters["stride"] = LogicalType::INTEGER;
+	ner_scan_fun.named_parameters["min_score"] = LogicalType::FLOAT;
+	ner_scan_fun.named_parameters["model"] = LogicalType::VARCHAR;
+	ner_scan_fun.named_parameters["prefilter"] = LogicalType::VARCHAR;
+	loader.RegisterFunction(ner_scan_fun);
+
+	// Register 'ner_cache_stats', the counters of the result cache
+	TableFunction ner_cache_stats_fun("ner_cache_stats", {}, NerCacheStatsFun, NerCacheStatsBind, NerCacheStatsInit);
+	loader.RegisterFunction(ner_cache_stats_fun);
+
+	// Register 'ner_model_info', the model in use and the progress of its replacement
+	TableFunction ner_model_info_fun("ner_model_info", {}, NerModelInfoFun, NerModelInfoBind, NerModelInfoInit);
+	loader.RegisterFunction(ner_model_info_fun);
+
+	// Register 'ner_load_model' and 'ner_models', the named models selected by model :=
+	TableFunction ner_load_model_fun("ner_load_model", {LogicalType::VARCHAR, LogicalType::VARCHAR}, NerLoadModelFun,
+	                                 NerLoadModelBind, NerLoadModelInit);
+	loader.RegisterFunction(ner_load_model_fun);
+	TableFunction ner_models_fun("ner_models", {}, NerModelsFun, NerModelsBind, NerModelsInit);
+	loader.RegisterFunction(ner_models_fun);
+
+	// Register 'ner_stats' and 'ner_stats_reset', the profiling counters
+	TableFunction ner_stats_fun("ner_stats", {}, NerStatsFun, NerStatsBind, NerStatsInit);
+	loader.RegisterFunction(ner_stats_fun);
+	TableFunction ner_stats_reset_fun("ner_stats_reset", {}, NerStatsResetFun, NerStatsResetBind, NerStatsResetInit);
+	loader.RegisterFunction(ner_stats_reset_fun);
+
 	auto &config = DBConfig::GetConfig(db);
 	config.AddExtensionOption("ner_model_path", "Path to the NER model file", LogicalType::VARCHAR, Value(),
 	                          SetNerModelPath);
+	config.AddExtensionOption("ner_threads",
+	                          "Threads used by each ner() evaluation on top of DuckDB's own threads (0: automatic)",
+	                          LogicalType::BIGINT, Value::BIGINT(1), SetNerThreads);
+	config.AddExtensionOption("ner_memory_limit",
+	                          "Maximum memory of the compute buffers of each ner() evaluation, e.g. '256MB' "
+	                          "(default: none)",
+	                          LogicalType::VARCHAR, Value(), SetNerMemoryLimit);
+	config.AddExtensionOption("ner_cache_size", "Number of texts whose ner() results are cached (0: disabled)",
+	                          LogicalType::BIGINT, Value::BIGINT(0), SetNerCacheSize);
+	config.AddExtensionOption("ner_cache_max_text_length", "Texts longer than this many bytes are not cached",
+	                          LogicalType::BIGINT, Value::BIGINT(4096), SetNerCacheMaxTextLength);
+	config.AddExtensionOption("ner_max_models", "Number of models registered by ner_load_model kept in memory",
+	                          LogicalType::BIGINT, Value::BIGINT(4), SetNerMaxModels);
 }
 
 void NerExtension::Load(ExtensionLoader &loader) {
@@ -0,0 +1,339 @@
+#include "ner_kernels.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+static const float NER_NORM_EPS = 1e-12f;
+static const float NER_GELU_COEF_A = 0.044715f;
+static const float NER_SQRT_2_OVER_PI = 0.79788456080286535587989211986876f;
+// Queries sharing each tile of keys in ner_attention, and keys per tile: a tile of K and V rows of 64 values
+// (BERT's d_head) takes 32 KB, which stays in L1/L2 while the queries of the tile go through it
+static const int64_t NER_ATT_TILE_Q = 8;
+static const int64_t NER_ATT_TILE_K = 64;
+
+// Rows [*begin, *end) of t handled by thread ith out of nth
+static void ner_thread_rows(const struct ggml_tensor *t, int ith, int nth, int64_t *begin, int64_t *end) {
+	const int64_t n_rows = ggml_nrows(t);
+	const int64_t n_per_thread = (n_rows + nth - 1) / nth;
+	*begin = std::min(n_rows, n_per_thread * ith);
+	*end = std::min(n_rows, *begin + n_per_thread);
+}
+
+static inline float *ner_row(const struct ggml_tensor *t, int64_t i1, int64_t i2, int64_t i3) {
+	return (float *)((char *)t->data + i1 * t->nb[1] + i2 * t->nb[2] + i3 * t->nb[3]);
+}
+
+// Indices (i1, i2, i3) of row r of t
+static inline void ner_row_index(const struct ggml_tensor *t, int64_t r, int64_t *i1, int64_t *i2, int64_t *i3) {
+	*i1 = r % t->ne[1];
+	*i2 = r / t->ne[1] % t->ne[2];
+	*i3 = r / (t->ne[1] * t->ne[2]);
+}
+
+// Row of the broadcast operand b paired with row (i1, i2, i3) of the other operand
+static inline float *ner_bcast_row(const struct ggml_tensor *b, int64_t i1, int64_t i2, int64_t i3) {
+	return ner_row(b, i1 % b->ne[1], i2 % b->ne[2], i3 % b->ne[3]);
+}
+
+static inline bool ner_can_bcast(const struct ggml_tensor *a, const struct ggml_tensor *b) {
+	return b->type == GGML_TYPE_F32 && b->ne[0] == a->ne[0] && a->ne[1] % b->ne[1] == 0 &&
+	       a->ne[2] % b->ne[2] == 0 && a->ne[3] % b->ne[3] == 0 && b->nb[0] == sizeof(float);
+}
+
+// Dot product and y += a * x over n floats, vectorized for the instruction set the extension is compiled for,
+// like ggml's own kernels. The scalar version keeps independent partial sums so that compilers can vectorize it too.
+static inline float ner_dot(const float *x, const float *y, int64_t n) {
+	int64_t i = 0;
+	float sum = 0.0f;
+#if defined(__AVX2__) && defined(__FMA__)
+	__m256 acc0 = _mm256_setzero_ps();
+	__m256 acc1 = _mm256_setzero_ps();
+	for (; i + 16 <= n; i += 16) {
+		acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), acc0);
+		acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + 8), _mm256_loadu_ps(y + i + 8), acc1);
+	}
+	__m256 acc = _mm256_add_ps(acc0, acc1);
+	__m128 acc4 = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+	acc4 = _mm_add_ps(acc4, _mm_movehl_ps(acc4, acc4));
+	acc4 = _mm_add_ss(acc4, _mm_movehdup_ps(acc4));
+	sum = _mm_cvtss_f32(acc4);
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	float32x4_t acc0 = vdupq_n_f32(0.0f);
+	float32x4_t acc1 = vdupq_n_f32(0.0f);
+	for (; i + 8 <= n; i += 8) {
+		acc0 = vfmaq_f32(acc0, vld1q_f32(x + i), vld1q_f32(y + i));
+		acc1 = vfmaq_f32(acc1, vld1q_f32(x + i + 4), vld1q_f32(y + i + 4));
+	}
+	sum = vaddvq_f32(vaddq_f32(acc0, acc1));
+#elif defined(__wasm_simd128__)
+	v128_t acc = wasm_f32x4_splat(0.0f);
+	for (; i + 4 <= n; i += 4) {
+		acc = wasm_f32x4_add(acc, wasm_f32x4_mul(wasm_v128_load(x + i), wasm_v128_load(y + i)));
+	}
+	sum = wasm_f32x4_extract_lane(acc, 0) + wasm_f32x4_extract_lane(acc, 1) + wasm_f32x4_extract_lane(acc, 2) +
+	      wasm_f32x4_extract_lane(acc, 3);
+#else
+	float sum4[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+	for (; i + 4 <= n; i += 4) {
+		for (int j = 0; j < 4; j++) {
+			sum4[j] += x[i + j] * y[i + j];
+		}
+	}
+	sum = (sum4[0] + sum4[1]) + (sum4[2] + sum4[3]);
+#endif
+	for (; i < n; i++) {
+		sum += x[i] * y[i];
+	}
+	return sum;
+}
+
+static inline void ner_axpy(float *y, float a, const float *x, int64_t n) {
+	int64_t i = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+	const __m256 a8 = _mm256_set1_ps(a);
+	for (; i + 8 <= n; i += 8) {
+		_mm256_storeu_ps(y + i, _mm256_fmadd_ps(a8, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+	}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	const float32x4_t a4 = vdupq_n_f32(a);
+	for (; i + 4 <= n; i += 4) {
+		vst1q_f32(y + i, vfmaq_f32(vld1q_f32(y + i), a4, vld1q_f32(x + i)));
+	}
+#elif defined(__wasm_simd128__)
+	const v128_t a4 = wasm_f32x4_splat(a);
+	for (; i + 4 <= n; i += 4) {
+		wasm_v128_store(y + i, wasm_f32x4_add(wasm_v128_load(y + i), wasm_f32x4_mul(a4, wasm_v128_load(x + i))));
+	}
+#endif
+	for (; i < n; i++) {
+		y[i] += a * x[i];
+	}
+}
+
+static inline float ner_gelu(float x) {
+	return 0.5f * x * (1.0f + tanhf(NER_SQRT_2_OVER_PI * x * (1.0f + NER_GELU_COEF_A * x * x)));
+}
+
+static void ner_add_bcast_op(struct ggml_tensor *dst, const struct ggml_tensor *a, const struct ggml_tensor *b, int ith,
+                             int nth, void *) {
+	const int64_t ne0 = a->ne[0];
+	int64_t begin, end;
+	ner_thread_rows(a, ith, nth, &begin, &end);
+	for (int64_t r = begin; r < end; r++) {
+		int64_t i1, i2, i3;
+		ner_row_index(a, r, &i1, &i2, &i3);
+		const float *x = ner_row(a, i1, i2, i3);
+		const float *y = ner_bcast_row(b, i1, i2, i3);
+		float *z = ner_row(dst, i1, i2, i3);
+		for (int64_t i = 0; i < ne0; i++) {
+			z[i] = x[i] + y[i];
+		}
+	}
+}
+
+static void ner_add_gelu_op(struct ggml_tensor *dst, const struct ggml_tensor *a, const struct ggml_tensor *bias,
+                            int ith, int nth, void *) {
+	const int64_t ne0 = a->ne[0];
+	const float *y = (const float *)bias->data;
+	int64_t begin, end;
+	ner_thread_rows(a, ith, nth, &begin, &end);
+	for (int64_t r = begin; r < end; r++) {
+		int64_t i1, i2, i3;
+		ner_row_index(a, r, &i1, &i2, &i3);
+		const float *x = ner_row(a, i1, i2, i3);
+		float *z = ner_row(dst, i1, i2, i3);
+		for (int64_t i = 0; i < ne0; i++) {
+			z[i] = ner_gelu(x[i] + y[i]);
+		}
+	}
+}
+
+static void ner_add_residual_op(struct ggml_tensor *dst, const struct ggml_tensor *a, const struct ggml_tensor *bias,
+                                const struct ggml_tensor *residual, int ith, int nth, void *) {
+	const int64_t ne0 = a->ne[0];
+	const float *y = (const float *)bias->data;
+	int64_t begin, end;
+	ner_thread_rows(a, ith, nth, &begin, &end);
+	for (int64_t r = begin; r < end; r++) {
+		int64_t i1, i2, i3;
+		ner_row_index(a, r, &i1, &i2, &i3);
+		const float *x = ner_row(a, i1, i2, i3);
+		const float *res = ner_row(residual, i1, i2, i3);
+		float *z = ner_row(dst, i1, i2, i3);
+		for (int64_t i = 0; i < ne0; i++) {
+			z[i] = x[i] + y[i] + res[i];
+		}
+	}
+}
+
+static void ner_norm_affine_op(struct ggml_tensor *dst, const struct ggml_tensor *a, const struct ggml_tensor *w,
+                               const struct ggml_tensor *b, int ith, int nth, void *) {
+	const int64_t ne0 = a->ne[0];
+	const float *gamma = (const float *)w->data;
+	const float *beta = (const float *)b->data;
+	int64_t begin, end;
+	ner_thread_rows(a, ith, nth, &begin, &end);
+	for (int64_t r = begin; r < end; r++) {
+		int64_t i1, i2, i3;
+		ner_row_index(a, r, &i1, &i2, &i3);
+		const float *x = ner_row(a, i1, i2, i3);
+		float *z = ner_row(dst, i1, i2, i3);
+
+		double sum = 0.0;
+		for (int64_t i = 0; i < ne0; i++) {
+			sum += x[i];
+		}
+		const float mean = (float)(sum / ne0);
+		double sum2 = 0.0;
+		for (int64_t i = 0; i < ne0; i++) {
+			const float d = x[i] - mean;
+			sum2 += (double)d * d;
+		}
+		const float scale = 1.0f / sqrtf((float)(sum2 / ne0) + NER_NORM_EPS);
+		for (int64_t i = 0; i < ne0; i++) {
+			z[i] = (x[i] - mean) * scale * gamma[i] + beta[i];
+		}
+	}
+}
+
+static void ner_attention_op(struct ggml_tensor *dst, const struct ggml_tensor *q, const struct ggml_tensor *k,
+                             const struct ggml_tensor *v, int ith, int nth, void *userdata) {
+	const auto *params = (const struct ner_attention_params *)userdata;
+	const struct ggml_tensor *mask = params->mask;
+	const int64_t N = mask->ne[0];
+	const int64_t B = mask->ne[3];
+	const int64_t n_head = params->n_head;
+	const int64_t d_head = q->ne[0] / n_head;
+	const int64_t n_tiles = (N + NER_ATT_TILE_Q - 1) / NER_ATT_TILE_Q;
+
+	// Work items are (sequence, head, tile of queries), split evenly between threads
+	const int64_t n_items = B * n_head * n_tiles;
+	const int64_t n_per_thread = (n_items + nth - 1) / nth;
+	const int64_t item_begin = std::min(n_items, n_per_thread * ith);
+	const int64_t item_end = std::min(n_items, item_begin + n_per_thread);
+
+	float scores[NER_ATT_TILE_Q][NER_ATT_TILE_K];
+	// running maximum and sum of the exponentials of each query's scores
+	float max[NER_ATT_TILE_Q];
+	float sum[NER_ATT_TILE_Q];
+	const float *q_rows[NER_ATT_TILE_Q];
+	float *out_rows[NER_ATT_TILE_Q];
+	for (int64_t item = item_begin; item < item_end; item++) {
+		const int64_t b = item / (n_head * n_tiles);
+		const int64_t h = item / n_tiles % n_head;
+		const int64_t i0 = item % n_tiles * NER_ATT_TILE_Q;
+		const int64_t n_q = std::min(NER_ATT_TILE_Q, N - i0);
+		const float *seq_mask = (const float *)((const char *)mask->data + b * mask->nb[3]);
+		const int64_t row0 = b * N;
+
+		// Outputs accumulate the weighted values in place, then are divided by the sum of the weights
+		for (int64_t r = 0; r < n_q; r++) {
+			q_rows[r] = ner_row(q, row0 + i0 + r, 0, 0) + h * d_head;
+			out_rows[r] = ner_row(dst, row0 + i0 + r, 0, 0) + h * d_head;
+			std::fill(out_rows[r], out_rows[r] + d_head, 0.0f);
+			max[r] = -INFINITY;
+			sum[r] = 0.0f;
+		}
+
+		for (int64_t j0 = 0; j0 < N; j0 += NER_ATT_TILE_K) {
+			const int64_t n_k = std::min(NER_ATT_TILE_K, N - j0);
+			// Padding is at the end of the sequences: skip the tiles made of it
+			bool any_key = false;
+			for (int64_t j = 0; j < n_k && !any_key; j++) {
+				any_key = seq_mask[j0 + j] != -INFINITY;
+			}
+			if (!any_key) {
+				continue;
+			}
+			for (int64_t r = 0; r < n_q; r++) {
+				if (seq_mask[i0 + r] == -INFINITY) {
+					// a padded query: nothing reads its output
+					continue;
+				}
+				float tile_max = -INFINITY;
+				for (int64_t j = 0; j < n_k; j++) {
+					float s = seq_mask[j0 + j];
+					if (s != -INFINITY) {
+						const float *k_row = ner_row(k, row0 + j0 + j, 0, 0) + h * d_head;
+						s += params->scale * ner_dot(q_rows[r], k_row, d_head);
+					}
+					scores[r][j] = s;
+					tile_max = std::max(tile_max, s);
+				}
+				if (tile_max == -INFINITY) {
+					continue;
+				}
+				// Online softmax: rescale what was accumulated with the previous maximum
+				if (tile_max > max[r]) {
+					const float correction = expf(max[r] - tile_max);
+					for (int64_t d = 0; d < d_head; d++) {
+						out_rows[r][d] *= correction;
+					}
+					sum[r] *= correction;
+					max[r] = tile_max;
+				}
+				for (int64_t j = 0; j < n_k; j++) {
+					if (scores[r][j] == -INFINITY) {
+						continue;
+					}
+					const float p = expf(scores[r][j] - max[r]);
+					sum[r] += p;
+					ner_axpy(out_rows[r], p, ner_row(v, row0 + j0 + j, 0, 0) + h * d_head, d_head);
+				}
+			}
+		}
+
+		for (int64_t r = 0; r < n_q; r++) {
+			const float inv_sum = sum[r] > 0.0f ? 1.0f / sum[r] : 0.0f;
+			for (int64_t d = 0; d < d_head; d++) {
+				out_rows[r][d] *= inv_sum;
+			}
+		}
+	}
+}
+
+bool ner_fused_operand(const struct ggml_tensor *t) {
+	return t->type == GGML_TYPE_F32 && ggml_is_contiguous(t);
+}
+
+struct ggml_tensor *ner_add_bcast(struct ggml_context *ctx, struct ggml_tensor *a, struct ggml_tensor *b) {
+	assert(ggml_is_contiguous(a) && ner_can_bcast(a, b));
+	return ggml_map_custom2(ctx, a, b, ner_add_bcast_op, GGML_N_TASKS_MAX, nullptr);
+}
+
+struct ggml_tensor *ner_add_gelu(struct ggml_context *ctx, struct ggml_tensor *a, struct ggml_tensor *bias) {
+	assert(ggml_is_contiguous(a) && ner_fused_operand(bias) && ggml_nelements(bias) == a->ne[0]);
+	return ggml_map_custom2(ctx, a, bias, ner_add_gelu_op, GGML_N_TASKS_MAX, nullptr);
+}
+
+struct ggml_tensor *ner_add_residual(struct ggml_context *ctx, struct ggml_tensor *a, struct ggml_tensor *bias,
+                                     struct ggml_tensor *residual) {
+	assert(ggml_is_contiguous(a) && ner_fused_operand(bias) && ggml_nelements(bias) == a->ne[0] &&
+	       ner_fused_operand(residual) && residual->ne[0] == a->ne[0] && ggml_nrows(residual) == ggml_nrows(a));
+	return ggml_map_custom3(ctx, a, bias, residual, ner_add_residual_op, GGML_N_TASKS_MAX, nullptr);
+}
+
+struct ggml_tensor *ner_norm_affine(struct ggml_context *ctx, struct ggml_tensor *a, struct ggml_tensor *w,
+                                    struct ggml_tensor *b) {
+	assert(ggml_is_contiguous(a) && ner_fused_operand(w) && ner_fused_operand(b) && ggml_nelements(w) == a->ne[0] &&
+	       ggml_nelements(b) == a->ne[0]);
+	return ggml_map_custom3(ctx, a, w, b, ner_norm_affine_op, GGML_N_TASKS_MAX, nullptr);
+}
+
+struct ggml_tensor *ner_attention(struct ggml_context *ctx, struct ggml_tensor *q, struct ggml_tensor *k,
+                                  struct ggml_tensor *v, const struct ner_attention_params *params) {
+	assert(q->nb[0] == sizeof(float) && k->nb[0] == sizeof(float) && v->nb[0] == sizeof(float) &&
+	       ggml_nelements(k) == ggml_nelements(q) && ggml_nelements(v) == ggml_nelements(q) &&
+	       q->ne[0] % params->n_head == 0 &&
+	       ggml_nrows(q) == params->mask->ne[0] * params->mask->ne[3]);
+	return ggml_map_custom3(ctx, q, k, v, ner_attention_op, GGML_N_TASKS_MAX, (void *)params);
+}
@@ -1,19 +1,95 @@
 #include "ner_model.hpp"
+#include "ner_kernels.hpp"
+#include "ner_unicode.hpp"
 
 #include "ggml.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdio>
 #include <cstring>
-#include <fstream>
-#include <iostream>
 #include <map>
+#include <memory>
 #include <string>
 #include <thread>
 #include <vector>
-#include <istream>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Counters behind ner_stats_get, laid out like struct ner_stats
+static std::atomic<uint64_t> ner_stats_values[sizeof(ner_stats) / sizeof(uint64_t)];
+
+#define NER_STAT(field) ner_stats_values[offsetof(ner_stats, field) / sizeof(uint64_t)]
+
+static inline void ner_stat_add(std::atomic<uint64_t> &stat, uint64_t value) {
+	stat.fetch_add(value, std::memory_order_relaxed);
+}
+
+static inline void ner_stat_max(std::atomic<uint64_t> &stat, uint64_t value) {
+	uint64_t current = stat.load(std::memory_order_relaxed);
+	while (current < value && !stat.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+	}
+}
+
+// Counts value in the histogram starting at hist
+static inline void ner_stat_hist(std::atomic<uint64_t> &hist, uint64_t value) {
+	int bucket = 0;
+	for (; value && bucket < NER_STATS_HIST_BUCKETS - 1; value >>= 1) {
+		bucket++;
+	}
+	ner_stat_add((&hist)[bucket], 1);
+}
+
+static inline uint64_t ner_time_ns() {
+	auto now = std::chrono::steady_clock::now().time_since_epoch();
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+void ner_stats_get(struct ner_stats *stats) {
+	auto *values = (uint64_t *)stats;
+	for (size_t i = 0; i < sizeof(ner_stats) / sizeof(uint64_t); i++) {
+		values[i] = ner_stats_values[i].load(std::memory_order_relaxed);
+	}
+}
+
+void ner_stats_reset(void) {
+	for (auto &value : ner_stats_values) {
+		value.store(0, std::memory_order_relaxed);
+	}
+}
+
+// Original bert.cpp-style files: tensor data follows the tensor name without any padding
+static const uint32_t NER_FILE_MAGIC_GGML = 0x67676d6c; // "ggml"
+// Versioned files written by scripts/convert_ner_to_ggml.py. Version 2 adds the label names after the vocabulary.
+// Version 3 ("compiled", written by scripts/compile_model.py) replaces the vocabulary and the tensor headers with
+// an index that is used in place, see ner_load_compiled.
+static const uint32_t NER_FILE_MAGIC = 0x67676e72; // "ggnr"
+static const uint32_t NER_FILE_VERSION = 3;
+// Tensor data of versioned files starts at multiples of this offset, so it can be used in place
+static const size_t NER_TENSOR_ALIGN = 32;
+// Every section of the index and every tensor of compiled files starts at a multiple of this offset
+static const size_t NER_COMPILED_ALIGN = 64;
+
+static inline size_t ner_pad(size_t x, size_t alignment) {
+	return (x + alignment - 1) / alignment * alignment;
+}
 
 struct ner_hparams {
 	int32_t n_vocab = 30522;
@@ -43,13 +119,176 @@ struct ner_layer {
 	struct ggml_tensor *ff_i_b;
 	struct ggml_tensor *ff_o_w;
 	struct ggml_tensor *ff_o_b;
+	// Derived at load time by ner_prepare_weights: the query, key and value projections as one [n_embd, 3 * n_embd]
+	// matrix, the attention scale being folded into its query rows. Null if q_w, k_w and v_w differ in type,
+	// in which case q_w and q_b are replaced by scaled copies.
+	struct ggml_tensor *qkv_w;
+	struct ggml_tensor *qkv_b;
 };
 
+// Token flags, precomputed per vocabulary id
+enum ner_token_flags : uint8_t {
+	NER_TOKEN_SPECIAL = 1, // [CLS], [SEP], [PAD], ...
+	NER_TOKEN_SUBWORD = 2, // ##-prefixed continuation of a word
+};
+
+static inline uint32_t ner_hash_step(uint32_t hash, char c) {
+	return (hash ^ (uint8_t)c) * 16777619u;
+}
+
+static const uint32_t NER_HASH_SEED = 2166136261u;
+
+static inline uint32_t ner_hash(const char *str, size_t len) {
+	uint32_t hash = NER_HASH_SEED;
+	for (size_t i = 0; i < len; i++) {
+		hash = ner_hash_step(hash, str[i]);
+	}
+	return hash;
+}
+
+// Open-addressing hash table from token text to id. Slots store the hash next to the id,
+// so that a probe only touches the vocabulary strings when the hashes match.
+// Compiled model files store the table as is: keep its layout and the way it is built in sync with
+// scripts/compile_model.py.
+struct ner_vocab_table {
+	struct slot {
+		uint32_t hash;
+		ner_vocab_id id;
+	};
+	// storage, or a compiled model image
+	const slot *slots = nullptr;
+	uint32_t mask = 0;
+	std::vector<slot> storage;
+};
+
+// The vocabulary is kept in flat arrays: token strings back to back (NUL-terminated) in pool,
+// and two hash tables over them. Word-initial tokens and ## continuations are keyed without the ##.
+// The arrays are parsed into the storage members, or used straight from the image of compiled models.
 struct ner_vocab {
-	std::map<std::string, ner_vocab_id> token_to_id;
-	std::map<std::string, ner_vocab_id> subword_token_to_id;
-	std::map<ner_vocab_id, std::string> _id_to_token;
-	std::map<ner_vocab_id, std::string> _id_to_subword_token;
+	const char *pool = nullptr;
+	const uint32_t *offsets = nullptr;
+	const uint8_t *flags = nullptr;
+	ner_vocab_id n_vocab = 0;
+	std::string pool_storage;
+	std::vector<uint32_t> offsets_storage;
+	std::vector<uint8_t> flags_storage;
+	ner_vocab_table words;
+	ner_vocab_table subwords;
+	// Longest key in the tables, in bytes; no longer prefix of a word needs to be probed
+	int32_t max_token_len = 0;
+	ner_vocab_id cls_id = -1;
+	ner_vocab_id sep_id = -1;
+	// Uncased vocabulary: words are lowercased and stripped of accents before WordPiece
+	bool lowercase = false;
+
+	const char *token(ner_vocab_id id) const {
+		return pool + offsets[id];
+	}
+	size_t token_len(ner_vocab_id id) const {
+		return offsets[id + 1] - offsets[id] - 1;
+	}
+	// Text of the id as stored in the tables, i.e. without the ## of continuations
+	const char *key(ner_vocab_id id) const {
+		return token(id) + ((flags[id] & NER_TOKEN_SUBWORD) ? 2 : 0);
+	}
+	size_t key_len(ner_vocab_id id) const {
+		return token_len(id) - ((flags[id] & NER_TOKEN_SUBWORD) ? 2 : 0);
+	}
+
+	ner_vocab_id find(const ner_vocab_table &table, uint32_t hash, const char *str, size_t len) const {
+		for (uint32_t i = hash & table.mask;; i = (i + 1) & table.mask) {
+			const auto &slot = table.slots[i];
+			if (slot.id < 0) {
+				return -1;
+			}
+			if (slot.hash == hash && key_len(slot.id) == len && memcmp(key(slot.id), str, len) == 0) {
+				return slot.id;
+			}
+		}
+	}
+
+	void insert(ner_vocab_table &table, ner_vocab_id id) {
+		const char *str = key(id);
+		const size_t len = key_len(id);
+		const uint32_t hash = ner_hash(str, len);
+		for (uint32_t i = hash & table.mask;; i = (i + 1) & table.mask) {
+			auto &slot = table.storage[i];
+			// later duplicates win, as they did with std::map
+			if (slot.id < 0 || (slot.hash == hash && key_len(slot.id) == len && memcmp(key(slot.id), str, len) == 0)) {
+				slot.hash = hash;
+				slot.id = id;
+				return;
+			}
+		}
+	}
+
+	// Builds the hash tables once all tokens are in the storage members
+	void build() {
+		pool = pool_storage.data();
+		offsets = offsets_storage.data();
+		flags = flags_storage.data();
+		n_vocab = (ner_vocab_id)flags_storage.size();
+		uint32_t n_slots = 16;
+		while (n_slots < 2 * (uint32_t)n_vocab) {
+			n_slots *= 2;
+		}
+		for (auto *table : {&words, &subwords}) {
+			table->storage.assign(n_slots, {0, -1});
+			table->slots = table->storage.data();
+			table->mask = n_slots - 1;
+		}
+		for (ner_vocab_id id = 0; id < n_vocab; id++) {
+			insert((flags[id] & NER_TOKEN_SUBWORD) ? subwords : words, id);
+			max_token_len = std::max(max_token_len, (int32_t)key_len(id));
+		}
+		detect_case();
+	}
+
+	// Model files do not say whether the model is uncased: its vocabulary then has no uppercase letter outside
+	// special tokens ([CLS], [UNK], ...)
+	void detect_case() {
+		lowercase = true;
+		for (ner_vocab_id id = 0; id < n_vocab && lowercase; id++) {
+			if (flags[id] & NER_TOKEN_SPECIAL) {
+				continue;
+			}
+			for (const char *c = token(id); *c && lowercase; c++) {
+				lowercase = *c < 'A' || *c > 'Z';
+			}
+		}
+	}
+};
+
+// Labels of the classifier for files without a label table: dslim/bert-base-NER and other CoNLL-2003 models
+static const char *NER_CONLL_LABELS[] = {"O", "B-MISC", "I-MISC", "B-PER", "I-PER", "B-ORG", "I-ORG", "B-LOC", "I-LOC"};
+
+// Labels of the classifier. IOB2 names ("B-PER", "I-PER", "O") are parsed once into an entity type and whether
+// the label starts a new entity; other names are types of their own, continuing entities of the same type.
+struct ner_labels {
+	std::vector<std::string> names;
+	std::vector<int32_t> type;
+	std::vector<uint8_t> begin;
+	// entity types, types[0] being "O" (no entity)
+	std::vector<std::string> types = {"O"};
+
+	void add(const char *name, size_t len) {
+		names.emplace_back(name, len);
+		std::string type_name(name, len);
+		bool is_begin = false;
+		if (len > 2 && (name[0] == 'B' || name[0] == 'I') && name[1] == '-') {
+			is_begin = name[0] == 'B';
+			type_name = type_name.substr(2);
+		}
+		int32_t id = 0;
+		if (type_name != "O") {
+			id = (int32_t)(std::find(types.begin(), types.end(), type_name) - types.begin());
+			if (id == (int32_t)types.size()) {
+				types.push_back(type_name);
+			}
+		}
+		type.push_back(id);
+		begin.push_back(is_begin);
+	}
 };
 
 struct ner_model {
@@ -63,7 +302,9 @@ struct ner_model {
 	// NER specific
 	struct ggml_tensor *classifier_weight;
 	struct ggml_tensor *classifier_bias;
-	struct ggml_context *ctx;
+	// position_embeddings + token_type_embeddings[0] in F32, derived at load time: inputs are a single segment
+	struct ggml_tensor *pos_type_embeddings;
+	struct ggml_context *ctx = nullptr;
 	std::map<std::string, struct ggml_tensor *> tensors;
 };
 
@@ -80,227 +321,988 @@ struct ner_buffer {
 	}
 };
 
+// Read-only view of a model file. Files are memory-mapped, so that weights are paged in lazily
+// and shared through the page cache between processes; in-memory models are borrowed as is.
+struct ner_mapping {
+	const uint8_t *data = nullptr;
+	size_t size = 0;
+	bool mapped = false;
+#ifdef _WIN32
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE map = NULL;
+#endif
+
+	bool map_file(const char *fname) {
+#ifdef _WIN32
+		file = CreateFileA(fname, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+		LARGE_INTEGER file_size;
+		if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+			return false;
+		}
+		map = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (!map) {
+			return false;
+		}
+		void *addr = MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+		if (!addr) {
+			return false;
+		}
+		size = (size_t)file_size.QuadPart;
+#else
+		int fd = open(fname, O_RDONLY);
+		if (fd < 0) {
+			return false;
+		}
+		struct stat st;
+		if (fstat(fd, &st) != 0 || st.st_size == 0) {
+			close(fd);
+			return false;
+		}
+		void *addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (addr == MAP_FAILED) {
+			return false;
+		}
+		size = (size_t)st.st_size;
+#endif
+		data = (const uint8_t *)addr;
+		mapped = true;
+		return true;
+	}
+
+	~ner_mapping() {
+#ifdef _WIN32
+		if (mapped) {
+			UnmapViewOfFile(data);
+		}
+		if (map) {
+			CloseHandle(map);
+		}
+		if (file != INVALID_HANDLE_VALUE) {
+			CloseHandle(file);
+		}
+#else
+		if (mapped) {
+			munmap((void *)data, size);
+		}
+#endif
+	}
+};
+
+// Bounds-checked cursor over a model image
+struct ner_reader {
+	const uint8_t *begin;
+	const uint8_t *cur;
+	const uint8_t *end;
+	bool ok = true;
+
+	ner_reader(const uint8_t *data, size_t size) : begin(data), cur(data), end(data + size) {
+	}
+
+	const uint8_t *take(size_t n) {
+		if (!ok || (size_t)(end - cur) < n) {
+			ok = false;
+			return nullptr;
+		}
+		const uint8_t *p = cur;
+		cur += n;
+		return p;
+	}
+	template <class T>
+	bool read(T &value) {
+		const uint8_t *p = take(sizeof(T));
+		if (p) {
+			memcpy(&value, p, sizeof(T));
+		}
+		return p != nullptr;
+	}
+	// Skips to the next multiple of alignment, counted from the start of the image
+	void align(size_t alignment) {
+		size_t misalignment = (size_t)(cur - begin) % alignment;
+		if (misalignment) {
+			take(alignment - misalignment);
+		}
+	}
+	bool eof() const {
+		return cur >= end;
+	}
+};
+
 struct ner_ctx {
 	ner_model model;
 	ner_vocab vocab;
-	size_t mem_per_token;
-	int64_t mem_per_input;
-	ner_buffer buf_compute;
+	ner_labels labels;
+	ner_mapping mapping;
+	// weights that could not be used in place from the mapping
+	ner_buffer buf_weights;
+	// weights derived from the file's by ner_prepare_weights
+	ner_buffer buf_derived;
 };
 
-// Memory stream buffer for loading from memory
-struct memory_buffer : std::streambuf {
-	memory_buffer(const uint8_t *begin, size_t size) {
-		char *p = const_cast<char *>(reinterpret_cast<const char *>(begin));
-		this->setg(p, p, p + size);
+// Padded sequence lengths for which compute graphs are built and cached
+static const int32_t NER_SEQ_BUCKETS[] = {16, 32, 64, 128, 256, 512};
+// Maximal number of graphs kept alive per execution context: a chunk spanning every length bucket needs a graph for
+// its full batches and one for its last batch in each, so that no chunk rebuilds graphs once they are cached. Graphs
+// only hold their tensor objects, inputs and logits: the scratch regions are shared.
+static const size_t NER_MAX_GRAPHS = 2 * sizeof(NER_SEQ_BUCKETS) / sizeof(NER_SEQ_BUCKETS[0]);
+// Smallest number of (padded) tokens per thread for which a graph compute is split between threads
+static const int32_t NER_MIN_TOKENS_PER_THREAD = 16;
+
+// Intermediates of the encoder are placed in two scratch regions, reused by every layer: the self-attention
+// block writes to NER_SCRATCH_ATT, the embeddings and the feed-forward block to NER_SCRATCH_FF. A region is only
+// overwritten by the next layer once every consumer of its previous content has been computed.
+enum ner_scratch { NER_SCRATCH_ATT = 0, NER_SCRATCH_FF = 1, NER_SCRATCH_COUNT = 2 };
+
+// Memory needed to evaluate a graph: its own context (tensor objects, inputs and logits) and the scratch regions
+struct ner_graph_mem {
+	size_t ctx = 0;
+	size_t scratch[NER_SCRATCH_COUNT] = {};
+
+	size_t total() const {
+		return ctx + scratch[NER_SCRATCH_ATT] + scratch[NER_SCRATCH_FF];
 	}
 };
 
-// Simplified tokenizer based on bert.cpp
-void ner_tokenize(struct ner_ctx *ctx, const char *text, ner_vocab_id *tokens, int32_t *n_tokens,
-                  int32_t n_max_tokens) {
-	const auto &vocab = ctx->vocab;
-	const int cls_tok_id = vocab.token_to_id.at("[CLS]");
-	const int sep_tok_id = vocab.token_to_id.at("[SEP]");
-
-	std::string str = text;
-	std::vector<std::string> words;
-	// Simple space-based split for now, WordPiece will handle the rest
-	std::string word;
-	for (char c : str) {
-		if (isspace(c)) {
-			if (!word.empty()) {
-				words.push_back(word);
+// A compute graph built once for n_batch sequences padded to n_seq tokens.
+// Evaluating it again only rewrites the token ids and the attention mask.
+struct ner_graph {
+	int32_t n_seq = 0;
+	int32_t n_batch = 0;
+	uint64_t last_used = 0;
+	// measured while building the graph
+	ner_graph_mem mem;
+	ner_buffer buf_compute;
+	struct ggml_context *ctx = nullptr;
+	struct ggml_cgraph gf = {};
+	// inputs
+	struct ggml_tensor *tokens = nullptr;
+	struct ggml_tensor *mask = nullptr;
+	// read by the attention of every layer while computing
+	ner_attention_params attention = {};
+	// output
+	struct ggml_tensor *logits = nullptr;
+
+	~ner_graph() {
+		if (ctx) {
+			ggml_free(ctx);
+		}
+	}
+};
+
+// Everything ner_eval writes to lives here, so that one ner_ctx can be shared by many threads
+struct ner_exec {
+	struct ner_ctx *ctx;
+	// upper bound of the compute buffers below, 0 if unlimited
+	size_t memory_limit = 0;
+	uint64_t n_evals = 0;
+	std::vector<std::unique_ptr<ner_graph>> graphs;
+	// scratch regions shared by all graphs, sized for the largest of them
+	ner_buffer buf_scratch[NER_SCRATCH_COUNT];
+	// work buffer of ggml_graph_compute, shared by all graphs
+	ner_buffer buf_work;
+};
+
+// Longest prefix probed by the WordPiece matcher; vocabulary entries are far shorter in practice
+static const int32_t NER_MAX_PROBE_LEN = 128;
+// Longest normalized word, in bytes: longer words are matched in pieces of this size, each starting as a word
+static const int32_t NER_MAX_WORD_LEN = 256;
+
+// A word of the pre-tokenized text, as WordPiece matches it. Words that need no normalization are matched in place
+// in the text; the others are normalized into a buffer, each of their bytes keeping the range of the text it comes
+// from.
+struct ner_word {
+	const char *str;
+	int32_t len;
+	// offset of str in the text, for words in place
+	int32_t start;
+	// else the text range [begin[i], end[i]) of byte i, null for words in place
+	const int32_t *begin;
+	const int32_t *end;
+};
+
+// BERT's basic tokenizer, splitting text into words: at whitespace, around punctuation and CJK ideographs, and
+// removing control characters; the words of uncased models are also lowercased and stripped of accents. Runs of
+// ASCII letters and digits, i.e. most words of most texts, are found by ner_scan_word and matched in place; any
+// other character goes through the UTF-8 decoder and the Unicode tables.
+struct ner_pretokenizer {
+	const char *text;
+	const char *p;
+	const char *end;
+	bool lowercase;
+	// normalized word, with room for the 3 code points a character folds into at most
+	char buf[NER_MAX_WORD_LEN + 12];
+	int32_t buf_begin[NER_MAX_WORD_LEN + 12];
+	int32_t buf_end[NER_MAX_WORD_LEN + 12];
+
+	ner_pretokenizer(const char *text, size_t text_len, bool lowercase)
+	    : text(text), p(text), end(text + text_len), lowercase(lowercase) {
+	}
+
+	// The next word, false at the end of the text
+	bool next(ner_word &word) {
+		while (p < end) {
+			const uint8_t c = (uint8_t)*p;
+			if (c < 0x80) {
+				const uint8_t c_class = NER_ASCII_CLASS[c];
+				if (c_class == NER_CHAR_SPACE || c_class == NER_CHAR_REMOVED) {
+					p++;
+					continue;
+				}
+				if (c_class == NER_CHAR_PUNCT) {
+					return in_place(word, 1);
+				}
+				// A word in place if it ends at a separator; else it is normalized from its start
+				const char *q = ner_scan_word(p, end, lowercase);
+				if (q > p && (q == end || ((uint8_t)*q < 0x80 && (NER_ASCII_CLASS[(uint8_t)*q] == NER_CHAR_SPACE ||
+				                                                   NER_ASCII_CLASS[(uint8_t)*q] == NER_CHAR_PUNCT)))) {
+					return in_place(word, q - p);
+				}
+			}
+			uint32_t cp;
+			const size_t n = ner_utf8_decode(p, end, &cp);
+			const ner_char_class cp_class = n ? ner_char_classify(cp) : NER_CHAR_REMOVED;
+			if (cp_class == NER_CHAR_SPACE || cp_class == NER_CHAR_REMOVED) {
+				p += n ? n : 1;
+			} else if (cp_class == NER_CHAR_PUNCT || cp_class == NER_CHAR_CJK) {
+				return in_place(word, n);
+			} else if (normalize(word)) {
+				return true;
 			}
-			word.clear();
-		} else {
-			word += c;
 		}
+		return false;
 	}
-	if (!word.empty()) {
-		words.push_back(word);
+
+	bool in_place(ner_word &word, size_t len) {
+		word = {p, (int32_t)len, (int32_t)(p - text), nullptr, nullptr};
+		p += len;
+		return true;
 	}
 
-	int32_t t = 0;
-	tokens[t++] = cls_tok_id;
+	// Copies the word at p to buf, folded if lowercase. False if nothing is left of it (e.g. only accents).
+	bool normalize(ner_word &word) {
+		int32_t len = 0;
+		while (p < end && len < NER_MAX_WORD_LEN) {
+			uint32_t cp;
+			const size_t n = ner_utf8_decode(p, end, &cp);
+			const ner_char_class cp_class = n ? ner_char_classify(cp) : NER_CHAR_REMOVED;
+			if (cp_class == NER_CHAR_SPACE || cp_class == NER_CHAR_PUNCT || cp_class == NER_CHAR_CJK) {
+				break;
+			}
+			if (cp_class == NER_CHAR_WORD) {
+				uint32_t folded[3] = {cp};
+				const size_t n_folded = lowercase ? ner_char_fold(cp, folded) : 1;
+				const int32_t begin = (int32_t)(p - text);
+				for (size_t i = 0; i < n_folded; i++) {
+					const int32_t n_bytes = (int32_t)ner_utf8_encode(folded[i], buf + len);
+					for (int32_t b = 0; b < n_bytes; b++, len++) {
+						buf_begin[len] = begin;
+						buf_end[len] = begin + (int32_t)n;
+					}
+				}
+			}
+			p += n ? n : 1;
+		}
+		word = {buf, len, 0, buf_begin, buf_end};
+		return len > 0;
+	}
+};
 
-	for (const auto &word : words) {
+// Greedy longest-match-first WordPiece over the word. Prefix hashes are computed incrementally,
+// so every start position costs O(max_token_len) hash steps and no allocation.
+// spans (if not null) receive the byte range of every token in the text, n_unknown the number of bytes skipped
+// because no token matches them.
+// Returns false if the word was cut at n_max_tokens.
+static bool ner_wordpiece(const ner_vocab &vocab, const ner_word &word, ner_vocab_id *tokens, struct ner_span *spans,
+                          int32_t &t, int32_t n_max_tokens, uint64_t &n_unknown) {
+	uint32_t hashes[NER_MAX_PROBE_LEN + 1];
+	const ner_vocab_table *table = &vocab.words;
+	const char *str = word.str;
+	const int32_t n = word.len;
+	int32_t i = 0;
+	while (i < n) {
 		if (t >= n_max_tokens - 1) {
 			break;
 		}
-
-		int i = 0;
-		int n = word.size();
-		auto *token_map = &vocab.token_to_id;
-		while (i < n) {
-			if (t >= n_max_tokens - 1) {
+		const int32_t max_len = std::min({n - i, vocab.max_token_len, NER_MAX_PROBE_LEN});
+		hashes[0] = NER_HASH_SEED;
+		for (int32_t len = 1; len <= max_len; len++) {
+			hashes[len] = ner_hash_step(hashes[len - 1], str[i + len - 1]);
+		}
+		bool found = false;
+		for (int32_t len = max_len; len > 0; len--) {
+			auto id = vocab.find(*table, hashes[len], str + i, len);
+			if (id >= 0) {
+				if (spans) {
+					spans[t] = word.begin ? ner_span {word.begin[i], word.end[i + len - 1]}
+					                      : ner_span {word.start + i, word.start + i + len};
+				}
+				tokens[t++] = id;
+				i += len;
+				found = true;
 				break;
 			}
-			int j = n;
-			bool found = false;
-			while (j > i) {
-				auto it = token_map->find(word.substr(i, j - i));
-				if (it != token_map->end()) {
-					tokens[t++] = it->second;
-					i = j;
-					token_map = &vocab.subword_token_to_id;
-					found = true;
-					break;
-				}
-				--j;
+		}
+		table = &vocab.subwords;
+		if (!found) {
+			++i; // skip unknown
+			n_unknown++;
+		}
+	}
+	return i >= n;
+}
+
+// Tokenizer based on bert.cpp, with BERT's basic tokenizer in front of WordPiece. Streams over text[0..text_len),
+// which need not be NUL-terminated.
+bool ner_tokenize_spans(struct ner_ctx *ctx, const char *text, size_t text_len, ner_vocab_id *tokens,
+                        struct ner_span *spans, int32_t *n_tokens, int32_t n_max_tokens) {
+	const auto &vocab = ctx->vocab;
+	const uint64_t start_ns = ner_time_ns();
+
+	int32_t t = 0;
+	if (spans) {
+		spans[t] = {0, 0};
+	}
+	tokens[t++] = vocab.cls_id;
+
+	ner_pretokenizer pretokenizer(text, text_len, vocab.lowercase);
+	ner_word word;
+	bool truncated = false;
+	uint64_t n_unknown = 0;
+	while (t < n_max_tokens - 1 && pretokenizer.next(word)) {
+		if (!ner_wordpiece(vocab, word, tokens, spans, t, n_max_tokens, n_unknown)) {
+			truncated = true;
+		}
+	}
+	// Words left once the token budget is spent
+	const int32_t end = (int32_t)(pretokenizer.p - text);
+	truncated = truncated || pretokenizer.next(word);
+	if (spans) {
+		spans[t] = {end, end};
+	}
+	tokens[t++] = vocab.sep_id;
+	*n_tokens = t;
+
+	ner_stat_add(NER_STAT(n_tokenized), 1);
+	ner_stat_add(NER_STAT(n_tokens), t);
+	ner_stat_add(NER_STAT(n_truncated), truncated);
+	ner_stat_add(NER_STAT(n_unknown), n_unknown);
+	ner_stat_add(NER_STAT(tokenize_ns), ner_time_ns() - start_ns);
+	return truncated;
+}
+
+void ner_tokenize(struct ner_ctx *ctx, const char *text, size_t text_len, ner_vocab_id *tokens, int32_t *n_tokens,
+                  int32_t n_max_tokens) {
+	ner_tokenize_spans(ctx, text, text_len, tokens, nullptr, n_tokens, n_max_tokens);
+}
+
+// Words ending a sentence, after which a capitalized word is not necessarily a name
+static bool ner_ends_sentence(uint32_t cp) {
+	return cp == '.' || cp == '!' || cp == '?' || cp == 0x2026; // ...
+}
+
+bool ner_prefilter(struct ner_ctx *ctx, const char *text, size_t text_len) {
+	const auto &vocab = ctx->vocab;
+	const uint64_t start_ns = ner_time_ns();
+
+	bool candidate = vocab.lowercase;
+	bool sentence_start = true;
+	int32_t last_end = 0;
+	ner_pretokenizer pretokenizer(text, text_len, false);
+	ner_word word;
+	while (!candidate && pretokenizer.next(word)) {
+		// Lines start sentences too (titles, lists)
+		const int32_t start = word.begin ? word.begin[0] : word.start;
+		if (memchr(text + last_end, '\n', start - last_end)) {
+			sentence_start = true;
+		}
+		last_end = word.end ? word.end[word.len - 1] : word.start + word.len;
+
+		uint32_t cp;
+		size_t n = ner_utf8_decode(word.str, word.str + word.len, &cp);
+		const ner_char_class cp_class = ner_char_classify(cp);
+		if (cp_class == NER_CHAR_PUNCT) {
+			// Quotes and brackets keep the start of a sentence
+			sentence_start = sentence_start || ner_ends_sentence(cp);
+			continue;
+		}
+		// A capitalized first word must be a word the vocabulary knows in lowercase
+		const bool capitalized = sentence_start && cp >= 'A' && cp <= 'Z';
+		candidate = cp_class == NER_CHAR_CJK || (!ner_char_is_lower(cp) && !capitalized);
+		for (size_t i = n; i < (size_t)word.len && !candidate; i += n) {
+			n = ner_utf8_decode(word.str + i, word.str + word.len, &cp);
+			candidate = !ner_char_is_lower(cp);
+		}
+		if (!candidate && capitalized) {
+			char lower[NER_MAX_PROBE_LEN];
+			candidate = word.len > std::min(vocab.max_token_len, NER_MAX_PROBE_LEN);
+			if (!candidate) {
+				memcpy(lower, word.str, word.len);
+				lower[0] += 'a' - 'A';
+				candidate = vocab.find(vocab.words, ner_hash(lower, word.len), lower, word.len) < 0;
+			}
+		}
+		sentence_start = false;
+	}
+
+	ner_stat_add(NER_STAT(n_prefiltered), 1);
+	ner_stat_add(NER_STAT(n_prefilter_skip), !candidate);
+	ner_stat_add(NER_STAT(prefilter_ns), ner_time_ns() - start_ns);
+	return candidate;
+}
+
+// IOB2 decoding: a token continues the current entity if it predicts the same type with an I- label, or if it is a
+// ##-continuation of the previous word; special tokens are skipped.
+int32_t ner_decode(struct ner_ctx *ctx, const ner_vocab_id *tokens, const struct ner_span *spans, int32_t n_tokens,
+                   const float *logits, struct ner_entity *entities, int32_t n_max_entities) {
+	const auto &flags = ctx->vocab.flags;
+	const auto &labels = ctx->labels;
+	const int32_t n_labels = ctx->model.hparams.n_labels;
+	const uint64_t start_ns = ner_time_ns();
+
+	int32_t n_entities = 0;
+	int32_t n_entity_tokens = 0;
+	int32_t last_type = 0;
+	for (int32_t t = 0; t < n_tokens; t++) {
+		const uint8_t token_flags = flags[tokens[t]];
+		if (token_flags & NER_TOKEN_SPECIAL) {
+			continue;
+		}
+		const float *token_logits = logits + (size_t)t * n_labels;
+		int32_t best = 0;
+		for (int32_t l = 1; l < n_labels; l++) {
+			best = token_logits[l] > token_logits[best] ? l : best;
+		}
+
+		const int32_t type = labels.type[best];
+		if (type == 0) {
+			last_type = type;
+			continue;
+		}
+		// Softmax probability of the best label
+		float sum = 0.0f;
+		for (int32_t l = 0; l < n_labels; l++) {
+			sum += expf(token_logits[l] - token_logits[best]);
+		}
+		const float p = 1.0f / sum;
+
+		if (type == last_type && (!labels.begin[best] || (token_flags & NER_TOKEN_SUBWORD))) {
+			auto &entity = entities[n_entities - 1];
+			entity.end = spans[t].end;
+			n_entity_tokens++;
+			entity.score += (p - entity.score) / n_entity_tokens;
+		} else {
+			if (n_entities == n_max_entities) {
+				break;
 			}
-			if (!found) {
-				token_map = &vocab.subword_token_to_id;
-				++i; // skip unknown
+			entities[n_entities++] = {spans[t].start, spans[t].end, type, p};
+			n_entity_tokens = 1;
+		}
+		last_type = type;
+	}
+
+	ner_stat_add(NER_STAT(n_decoded), 1);
+	ner_stat_add(NER_STAT(n_entities), n_entities);
+	ner_stat_add(NER_STAT(decode_ns), ner_time_ns() - start_ns);
+	return n_entities;
+}
+
+// Tensor types the loader accepts. Quantized matrices are multiplied by ggml's own dot products (SIMD on x86 and ARM).
+static bool ner_tensor_type(int32_t ftype, ggml_type &type) {
+	switch (ftype) {
+	case GGML_TYPE_F32:
+	case GGML_TYPE_F16:
+	case GGML_TYPE_Q4_0:
+	case GGML_TYPE_Q8_0:
+		type = (ggml_type)ftype;
+		return true;
+	default:
+		return false;
+	}
+}
+
+// A tensor as stored in the model image
+struct ner_tensor_record {
+	ggml_type type;
+	int64_t ne[2];
+	const uint8_t *data;
+};
+
+// Tensors added to the model context by ner_prepare_weights
+#define NER_DERIVED_TENSORS(n_layer) (1 + 2 * (size_t)(n_layer))
+
+// Multiplies the n values of data, of the given type, by scale
+static void ner_scale_data(enum ggml_type type, void *data, int64_t n, float scale) {
+	if (type == GGML_TYPE_F32) {
+		auto *values = (float *)data;
+		for (int64_t i = 0; i < n; i++) {
+			values[i] *= scale;
+		}
+	} else if (type == GGML_TYPE_F16) {
+		auto *values = (ggml_fp16_t *)data;
+		for (int64_t i = 0; i < n; i++) {
+			values[i] = ggml_fp32_to_fp16(ggml_fp16_to_fp32(values[i]) * scale);
+		}
+	} else {
+		// Q4_0 and Q8_0 blocks start with their F16 scale
+		const size_t block_size = ggml_type_size(type);
+		for (int64_t b = 0; b < n / ggml_blck_size(type); b++) {
+			auto *d = (ggml_fp16_t *)((uint8_t *)data + b * block_size);
+			*d = ggml_fp32_to_fp16(ggml_fp16_to_fp32(*d) * scale);
+		}
+	}
+}
+
+// Load-time preprocessing of the weights, so that evaluations do less work:
+// - Q, K and V are projected by a single matrix multiplication, and 1/sqrt(d_head) is folded into the query
+//   weights and bias instead of scaling the scores of every head. With BERT's d_head = 64 the scale is a power of
+//   two, so folding it is exact in every format.
+// - token types are always 0, so their embedding is summed with the position embeddings once.
+// Weights are not repacked into another layout: ggml's matrix multiplication only takes its own.
+// The derived tensors live in buf_derived; the file's own Q, K and V weights are then no longer read.
+static bool ner_prepare_weights(ner_ctx *new_ner) {
+	auto &model = new_ner->model;
+	const auto &hparams = model.hparams;
+	const int64_t n_embd = hparams.n_embd;
+	const float kq_scale = 1.0f / sqrtf((float)(n_embd / hparams.n_head));
+
+	// Biases are F32, checked by ner_load_internal
+	auto fusable = [](const ner_layer &layer) {
+		return layer.q_w->type == layer.k_w->type && layer.q_w->type == layer.v_w->type;
+	};
+	size_t derived_size = ner_pad(n_embd * hparams.n_max_tokens * sizeof(float), NER_TENSOR_ALIGN);
+	for (auto &layer : model.layers) {
+		const size_t n_matrices = fusable(layer) ? 3 : 1;
+		derived_size += ner_pad(n_matrices * ggml_nbytes(layer.q_w), NER_TENSOR_ALIGN);
+		derived_size += ner_pad(n_matrices * ggml_nbytes(layer.q_b), NER_TENSOR_ALIGN);
+	}
+	new_ner->buf_derived.resize(derived_size + NER_TENSOR_ALIGN);
+	auto *dst = (uint8_t *)ner_pad((uintptr_t)new_ner->buf_derived.data, NER_TENSOR_ALIGN);
+	auto place = [&](struct ggml_tensor *tensor) {
+		tensor->data = dst;
+		dst += ner_pad(ggml_nbytes(tensor), NER_TENSOR_ALIGN);
+		return tensor;
+	};
+
+	for (auto &layer : model.layers) {
+		if (!fusable(layer)) {
+			layer.qkv_w = layer.qkv_b = nullptr;
+			auto *q_w = place(ggml_dup_tensor(model.ctx, layer.q_w));
+			auto *q_b = place(ggml_dup_tensor(model.ctx, layer.q_b));
+			memcpy(q_w->data, layer.q_w->data, ggml_nbytes(q_w));
+			memcpy(q_b->data, layer.q_b->data, ggml_nbytes(q_b));
+			ner_scale_data(q_w->type, q_w->data, ggml_nelements(q_w), kq_scale);
+			ner_scale_data(GGML_TYPE_F32, q_b->data, ggml_nelements(q_b), kq_scale);
+			layer.q_w = q_w;
+			layer.q_b = q_b;
+			continue;
+		}
+		// Rows are independent, even quantized: the fused matrix is the three stacked
+		layer.qkv_w = place(ggml_new_tensor_2d(model.ctx, layer.q_w->type, n_embd, 3 * n_embd));
+		layer.qkv_b = place(ggml_new_tensor_1d(model.ctx, GGML_TYPE_F32, 3 * n_embd));
+		auto *w = (uint8_t *)layer.qkv_w->data;
+		auto *b = (uint8_t *)layer.qkv_b->data;
+		const size_t w_size = ggml_nbytes(layer.q_w);
+		const size_t b_size = ggml_nbytes(layer.q_b);
+		memcpy(w, layer.q_w->data, w_size);
+		memcpy(w + w_size, layer.k_w->data, w_size);
+		memcpy(w + 2 * w_size, layer.v_w->data, w_size);
+		memcpy(b, layer.q_b->data, b_size);
+		memcpy(b + b_size, layer.k_b->data, b_size);
+		memcpy(b + 2 * b_size, layer.v_b->data, b_size);
+		ner_scale_data(layer.qkv_w->type, w, ggml_nelements(layer.q_w), kq_scale);
+		ner_scale_data(GGML_TYPE_F32, b, n_embd, kq_scale);
+	}
+
+	// Sum the embeddings with a throwaway graph, so that ggml converts them from whatever type they are stored in
+	model.pos_type_embeddings = place(ggml_new_tensor_2d(model.ctx, GGML_TYPE_F32, n_embd, hparams.n_max_tokens));
+	const int32_t n_rows = hparams.n_max_tokens;
+	struct ggml_init_params params = {.mem_size = 8 * ggml_tensor_overhead() + 2 * n_rows * sizeof(int32_t) +
+	                                              3 * n_rows * n_embd * sizeof(float) + 1024,
+	                                  .mem_buffer = NULL,
+	                                  .no_alloc = false};
+	struct ggml_context *ctx0 = ggml_init(params);
+	if (!ctx0) {
+		return false;
+	}
+	struct ggml_tensor *positions = ggml_new_tensor_1d(ctx0, GGML_TYPE_I32, n_rows);
+	struct ggml_tensor *token_types = ggml_new_tensor_1d(ctx0, GGML_TYPE_I32, n_rows);
+	for (int32_t i = 0; i < n_rows; i++) {
+		ggml_set_i32_1d(positions, i, i);
+	}
+	ggml_set_zero(token_types);
+	struct ggml_tensor *sum = ggml_add(ctx0, ggml_get_rows(ctx0, model.position_embeddings, positions),
+	                                   ggml_get_rows(ctx0, model.token_type_embeddings, token_types));
+	std::unique_ptr<struct ggml_cgraph> gf(new ggml_cgraph());
+	ggml_build_forward_expand(gf.get(), sum);
+	ggml_graph_compute_with_ctx(ctx0, gf.get(), 1);
+	memcpy(model.pos_type_embeddings->data, sum->data, ggml_nbytes(sum));
+	ggml_free(ctx0);
+	return true;
+}
+
+// Header of the index of compiled (version 3) files, which follows the label names at a multiple of
+// NER_COMPILED_ALIGN. Then come, each aligned the same way: the n_vocab + 1 token offsets into the pool (uint32),
+// the n_vocab token flags (ner_token_flags), the pool of NUL-terminated tokens, the word and subword hash tables
+// (n_slots ner_vocab_table::slot each) and the n_tensors ner_compiled_tensor entries.
+struct ner_compiled_header {
+	uint32_t n_slots;
+	int32_t max_token_len;
+	ner_vocab_id cls_id;
+	ner_vocab_id sep_id;
+	uint32_t pool_size;
+	uint32_t n_tensors;
+	uint32_t reserved[2];
+};
+
+struct ner_compiled_tensor {
+	char name[96];
+	int32_t type;
+	int32_t ne[2];
+	int32_t reserved;
+	// from the start of the image, a multiple of NER_COMPILED_ALIGN
+	uint64_t offset;
+	uint64_t size;
+};
+
+// n values of type T at p, used in place unless p is misaligned for T (an image copied to an arbitrary address),
+// in which case they are copied to storage
+template <class T>
+static const T *ner_view(const uint8_t *p, size_t n, std::vector<T> &storage) {
+	if ((uintptr_t)p % alignof(T) == 0) {
+		return (const T *)p;
+	}
+	storage.resize(n);
+	memcpy(storage.data(), p, n * sizeof(T));
+	return storage.data();
+}
+
+// Reads the index of a compiled file: the vocabulary is used in place once validated, which only takes a pass
+// over its arrays, and the tensors are listed in a table instead of being walked through the image.
+static bool ner_load_compiled(ner_ctx *new_ner, ner_reader &fin,
+                              std::map<std::string, struct ner_tensor_record> &records) {
+	const auto &hparams = new_ner->model.hparams;
+	auto &vocab = new_ner->vocab;
+	const size_t n_vocab = hparams.n_vocab;
+
+	ner_compiled_header header;
+	fin.align(NER_COMPILED_ALIGN);
+	fin.read(header);
+	auto section = [&](size_t size) {
+		fin.align(NER_COMPILED_ALIGN);
+		return fin.take(size);
+	};
+	const uint8_t *offsets = section((n_vocab + 1) * sizeof(uint32_t));
+	const uint8_t *flags = section(n_vocab);
+	const uint8_t *pool = section(header.pool_size);
+	const uint8_t *words = section((size_t)header.n_slots * sizeof(ner_vocab_table::slot));
+	const uint8_t *subwords = section((size_t)header.n_slots * sizeof(ner_vocab_table::slot));
+	const uint8_t *tensors = section((size_t)header.n_tensors * sizeof(ner_compiled_tensor));
+	if (!fin.ok || header.n_slots <= n_vocab || (header.n_slots & (header.n_slots - 1)) != 0 ||
+	    header.max_token_len < 0 || header.cls_id < 0 || header.cls_id >= hparams.n_vocab || header.sep_id < 0 ||
+	    header.sep_id >= hparams.n_vocab) {
+		return false;
+	}
+
+	vocab.n_vocab = hparams.n_vocab;
+	vocab.offsets = ner_view(offsets, n_vocab + 1, vocab.offsets_storage);
+	vocab.flags = flags;
+	vocab.pool = (const char *)pool;
+	vocab.max_token_len = header.max_token_len;
+	vocab.cls_id = header.cls_id;
+	vocab.sep_id = header.sep_id;
+	// Tokens are NUL-terminated, ## continuations longer than their prefix
+	if (vocab.offsets[0] != 0 || vocab.offsets[n_vocab] != header.pool_size) {
+		return false;
+	}
+	for (size_t id = 0; id < n_vocab; id++) {
+		const uint32_t begin = vocab.offsets[id];
+		const uint32_t end = vocab.offsets[id + 1];
+		if (end <= begin || vocab.pool[end - 1] != '\0' || vocab.flags[id] > (NER_TOKEN_SPECIAL | NER_TOKEN_SUBWORD) ||
+		    ((vocab.flags[id] & NER_TOKEN_SUBWORD) && end - begin < 3)) {
+			return false;
+		}
+	}
+	vocab.detect_case();
+	// Probes end at an empty slot, and only reach valid ids
+	for (auto table : {std::make_pair(&vocab.words, words), std::make_pair(&vocab.subwords, subwords)}) {
+		auto *slots = ner_view(table.second, header.n_slots, table.first->storage);
+		bool has_empty = false;
+		for (uint32_t i = 0; i < header.n_slots; i++) {
+			if (slots[i].id < -1 || slots[i].id >= hparams.n_vocab) {
+				return false;
 			}
+			has_empty |= slots[i].id == -1;
+		}
+		if (!has_empty) {
+			return false;
 		}
+		table.first->slots = slots;
+		table.first->mask = header.n_slots - 1;
 	}
-	tokens[t++] = sep_tok_id;
-	*n_tokens = t;
+
+	for (uint32_t i = 0; i < header.n_tensors; i++) {
+		ner_compiled_tensor entry;
+		memcpy(&entry, tensors + i * sizeof(ner_compiled_tensor), sizeof(entry));
+		ner_tensor_record record;
+		// Vectors (biases, LayerNorm parameters) are read as floats
+		if (!ner_tensor_type(entry.type, record.type) || entry.name[sizeof(entry.name) - 1] != '\0' ||
+		    entry.ne[0] <= 0 || entry.ne[1] <= 0 || (entry.ne[1] == 1 && record.type != GGML_TYPE_F32) ||
+		    entry.ne[0] % ggml_blck_size(record.type) != 0 ||
+		    entry.offset % NER_COMPILED_ALIGN != 0 || entry.offset > (uint64_t)(fin.end - fin.begin) ||
+		    entry.size > (uint64_t)(fin.end - fin.begin) - entry.offset) {
+			return false;
+		}
+		record.ne[0] = entry.ne[0];
+		record.ne[1] = entry.ne[1];
+		const size_t row_size = (ggml_type_size(record.type) * record.ne[0]) / ggml_blck_size(record.type);
+		if (entry.size != row_size * record.ne[1]) {
+			return false;
+		}
+		record.data = fin.begin + entry.offset;
+		records[entry.name] = record;
+	}
+	return true;
 }
 
-static struct ner_ctx *ner_load_internal(std::istream &fin) {
-	uint32_t magic;
-	fin.read((char *)&magic, sizeof(magic));
-	if (magic != 0x67676d6c) {
-		return nullptr;
+// Parses the model image [data, data + size) into ctx. Tensor data is referenced in place when it is suitably
+// aligned, so data must outlive ctx.
+static bool ner_load_internal(ner_ctx *new_ner, const uint8_t *data, size_t size) {
+	ner_reader fin(data, size);
+
+	uint32_t magic = 0;
+	fin.read(magic);
+	uint32_t version = 0;
+	if (magic == NER_FILE_MAGIC) {
+		fin.read(version);
+		if (version > NER_FILE_VERSION) {
+			return false;
+		}
+	} else if (magic != NER_FILE_MAGIC_GGML) {
+		return false;
 	}
 
-	ner_ctx *new_ner = new ner_ctx;
 	auto &hparams = new_ner->model.hparams;
-	fin.read((char *)&hparams.n_vocab, sizeof(hparams.n_vocab));
-	fin.read((char *)&hparams.n_max_tokens, sizeof(hparams.n_max_tokens));
-	fin.read((char *)&hparams.n_embd, sizeof(hparams.n_embd));
-	fin.read((char *)&hparams.n_intermediate, sizeof(hparams.n_intermediate));
-	fin.read((char *)&hparams.n_head, sizeof(hparams.n_head));
-	fin.read((char *)&hparams.n_layer, sizeof(hparams.n_layer));
-	fin.read((char *)&hparams.f16, sizeof(hparams.f16));
-	fin.read((char *)&hparams.n_labels, sizeof(hparams.n_labels));
-
-	for (int i = 0; i < hparams.n_vocab; i++) {
-		uint32_t len;
-		fin.read((char *)&len, sizeof(len));
-		std::string word(len, 0);
-		fin.read((char *)word.data(), len);
-		if (word.size() > 2 && word[0] == '#' && word[1] == '#') {
-			new_ner->vocab.subword_token_to_id[word.substr(2)] = i;
-			new_ner->vocab._id_to_subword_token[i] = word;
-		} else {
-			new_ner->vocab.token_to_id[word] = i;
-			new_ner->vocab._id_to_token[i] = word;
+	fin.read(hparams.n_vocab);
+	fin.read(hparams.n_max_tokens);
+	fin.read(hparams.n_embd);
+	fin.read(hparams.n_intermediate);
+	fin.read(hparams.n_head);
+	fin.read(hparams.n_layer);
+	fin.read(hparams.f16);
+	fin.read(hparams.n_labels);
+	// Every size must be positive, in compiled files too, before it sizes any buffer
+	if (!fin.ok || hparams.n_vocab <= 0 || hparams.n_max_tokens <= 0 || hparams.n_embd <= 0 ||
+	    hparams.n_intermediate <= 0 || hparams.n_head <= 0 || hparams.n_layer <= 0 || hparams.n_labels <= 0 ||
+	    hparams.n_embd % hparams.n_head != 0) {
+		return false;
+	}
+
+	// Compiled files store their vocabulary in their index, after the labels
+	auto &vocab = new_ner->vocab;
+	for (int i = 0; version < 3 && i < hparams.n_vocab; i++) {
+		uint32_t len = 0;
+		fin.read(len);
+		const char *word = (const char *)fin.take(len);
+		if (!word) {
+			return false;
+		}
+
+		uint8_t flags = 0;
+		if (len > 2 && word[0] == '#' && word[1] == '#') {
+			flags |= NER_TOKEN_SUBWORD;
+		} else if (len > 2 && word[0] == '[' && word[len - 1] == ']') {
+			flags |= NER_TOKEN_SPECIAL;
+		}
+		vocab.flags_storage.push_back(flags);
+		vocab.offsets_storage.push_back((uint32_t)vocab.pool_storage.size());
+		vocab.pool_storage.append(word, len);
+		vocab.pool_storage.push_back('\0');
+	}
+	if (version < 3) {
+		vocab.offsets_storage.push_back((uint32_t)vocab.pool_storage.size());
+		vocab.build();
+		vocab.cls_id = vocab.find(vocab.words, ner_hash("[CLS]", 5), "[CLS]", 5);
+		vocab.sep_id = vocab.find(vocab.words, ner_hash("[SEP]", 5), "[SEP]", 5);
+		if (vocab.cls_id < 0 || vocab.sep_id < 0) {
+			return false;
+		}
+	}
+
+	auto &labels = new_ner->labels;
+	if (version >= 2) {
+		for (int i = 0; i < hparams.n_labels; i++) {
+			uint32_t len = 0;
+			fin.read(len);
+			const char *name = (const char *)fin.take(len);
+			if (!name) {
+				return false;
+			}
+			labels.add(name, len);
+		}
+	} else if (hparams.n_labels == (int32_t)(sizeof(NER_CONLL_LABELS) / sizeof(NER_CONLL_LABELS[0]))) {
+		for (auto *name : NER_CONLL_LABELS) {
+			labels.add(name, strlen(name));
+		}
+	} else {
+		for (int i = 0; i < hparams.n_labels; i++) {
+			auto name = i == 0 ? std::string("O") : "LABEL_" + std::to_string(i);
+			labels.add(name.c_str(), name.size());
 		}
 	}
 
-	ggml_type wtype = (hparams.f16 == 2) ? GGML_TYPE_Q4_0 : (hparams.f16 == 1 ? GGML_TYPE_F16 : GGML_TYPE_F32);
-	size_t ctx_size = 512 * 1024 * 1024;
+	// Index the tensors of the image; the model only picks the ones it knows
+	std::map<std::string, ner_tensor_record> records;
+	if (version >= 3 && !ner_load_compiled(new_ner, fin, records)) {
+		return false;
+	}
+	while (version < 3 && fin.ok && !fin.eof()) {
+		int32_t n_dims = 0, length = 0, ftype_in = 0;
+		fin.read(n_dims);
+		fin.read(length);
+		fin.read(ftype_in);
+
+		ner_tensor_record record;
+		record.ne[0] = record.ne[1] = 1;
+		// Vectors (biases, LayerNorm parameters) are read as floats: files whose vectors were quantized by older
+		// conversion scripts are rejected
+		if (!ner_tensor_type(ftype_in, record.type) || n_dims < 1 || n_dims > 2 || length < 0 ||
+		    (n_dims == 1 && record.type != GGML_TYPE_F32)) {
+			return false;
+		}
+		for (int i = 0; i < n_dims; i++) {
+			int32_t ne_cur = 0;
+			fin.read(ne_cur);
+			record.ne[i] = ne_cur;
+		}
+		const char *name = (const char *)fin.take(length);
+		if (version > 0) {
+			fin.align(NER_TENSOR_ALIGN);
+		}
+		// Quantized rows are made of whole blocks
+		if (record.ne[0] % ggml_blck_size(record.type) != 0) {
+			return false;
+		}
+		size_t row_size = (ggml_type_size(record.type) * record.ne[0]) / ggml_blck_size(record.type);
+		record.data = fin.take(row_size * record.ne[1]);
+		if (!fin.ok) {
+			return false;
+		}
+		records[std::string(name, length)] = record;
+	}
 
-	struct ggml_init_params params = {.mem_size = ctx_size, .mem_buffer = NULL, .no_alloc = false};
+	// The model context only holds tensor headers: its size follows from the number of tensors,
+	// while the data lives in the image or in buf_weights
+	const size_t n_tensors = 7 + 16 * (size_t)hparams.n_layer + NER_DERIVED_TENSORS(hparams.n_layer);
+	struct ggml_init_params params = {
+	    .mem_size = (n_tensors + 1) * ggml_tensor_overhead(), .mem_buffer = NULL, .no_alloc = true};
 	new_ner->model.ctx = ggml_init(params);
 	auto &model = new_ner->model;
 	auto *ctx = model.ctx;
 
-	model.word_embeddings = ggml_new_tensor_2d(ctx, wtype, hparams.n_embd, hparams.n_vocab);
-	model.token_type_embeddings = ggml_new_tensor_2d(ctx, wtype, hparams.n_embd, 2);
-	model.position_embeddings = ggml_new_tensor_2d(ctx, wtype, hparams.n_embd, hparams.n_max_tokens);
-	model.ln_e_w = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_embd);
-	model.ln_e_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_embd);
-	model.classifier_weight = ggml_new_tensor_2d(ctx, wtype, hparams.n_embd, hparams.n_labels);
-	model.classifier_bias = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_labels);
-
-	model.tensors["embeddings.word_embeddings.weight"] = model.word_embeddings;
-	model.tensors["embeddings.token_type_embeddings.weight"] = model.token_type_embeddings;
-	model.tensors["embeddings.position_embeddings.weight"] = model.position_embeddings;
-	model.tensors["embeddings.LayerNorm.weight"] = model.ln_e_w;
-	model.tensors["embeddings.LayerNorm.bias"] = model.ln_e_b;
-	model.tensors["classifier.weight"] = model.classifier_weight;
-	model.tensors["classifier.bias"] = model.classifier_bias;
+	bool complete = true;
+	auto weight = [&](const std::string &name, int64_t ne0, int64_t ne1) -> struct ggml_tensor * {
+		auto it = records.find(name);
+		if (it == records.end() || it->second.ne[0] != ne0 || it->second.ne[1] != ne1) {
+			complete = false;
+			return nullptr;
+		}
+		auto *tensor = ne1 == 1 ? ggml_new_tensor_1d(ctx, it->second.type, ne0)
+		                        : ggml_new_tensor_2d(ctx, it->second.type, ne0, ne1);
+		model.tensors[name] = tensor;
+		return tensor;
+	};
+
+	model.word_embeddings = weight("embeddings.word_embeddings.weight", hparams.n_embd, hparams.n_vocab);
+	model.token_type_embeddings = weight("embeddings.token_type_embeddings.weight", hparams.n_embd, 2);
+	model.position_embeddings = weight("embeddings.position_embeddings.weight", hparams.n_embd, hparams.n_max_tokens);
+	model.ln_e_w = weight("embeddings.LayerNorm.weight", hparams.n_embd, 1);
+	model.ln_e_b = weight("embeddings.LayerNorm.bias", hparams.n_embd, 1);
+	model.classifier_weight = weight("classifier.weight", hparams.n_embd, hparams.n_labels);
+	model.classifier_bias = weight("classifier.bias", hparams.n_labels, 1);
 
 	model.layers.resize(hparams.n_layer);
 	for (int i = 0; i < hparams.n_layer; i++) {
 		auto &layer = model.layers[i];
-		layer.q_w = ggml_new_tensor_2d(ctx, wtype, hparams.n_embd, hparams.n_embd);
-		layer.q_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_embd);
-		layer.k_w = ggml_new_tensor_2d(ctx, wtype, hparams.n_embd, hparams.n_embd);
-		layer.k_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_embd);
-		layer.v_w = ggml_new_tensor_2d(ctx, wtype, hparams.n_embd, hparams.n_embd);
-		layer.v_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_embd);
-		layer.o_w = ggml_new_tensor_2d(ctx, wtype, hparams.n_embd, hparams.n_embd);
-		layer.o_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_embd);
-		layer.ln_att_w = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_embd);
-		layer.ln_att_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_embd);
-		layer.ff_i_w = ggml_new_tensor_2d(ctx, wtype, hparams.n_embd, hparams.n_intermediate);
-		layer.ff_i_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_intermediate);
-		layer.ff_o_w = ggml_new_tensor_2d(ctx, wtype, hparams.n_intermediate, hparams.n_embd);
-		layer.ff_o_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_embd);
-		layer.ln_out_w = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_embd);
-		layer.ln_out_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hparams.n_embd);
-
 		std::string base = "encoder.layer." + std::to_string(i) + ".";
-		model.tensors[base + "attention.self.query.weight"] = layer.q_w;
-		model.tensors[base + "attention.self.query.bias"] = layer.q_b;
-		model.tensors[base + "attention.self.key.weight"] = layer.k_w;
-		model.tensors[base + "attention.self.key.bias"] = layer.k_b;
-		model.tensors[base + "attention.self.value.weight"] = layer.v_w;
-		model.tensors[base + "attention.self.value.bias"] = layer.v_b;
-		model.tensors[base + "attention.output.dense.weight"] = layer.o_w;
-		model.tensors[base + "attention.output.dense.bias"] = layer.o_b;
-		model.tensors[base + "attention.output.LayerNorm.weight"] = layer.ln_att_w;
-		model.tensors[base + "attention.output.LayerNorm.bias"] = layer.ln_att_b;
-		model.tensors[base + "intermediate.dense.weight"] = layer.ff_i_w;
-		model.tensors[base + "intermediate.dense.bias"] = layer.ff_i_b;
-		model.tensors[base + "output.dense.weight"] = layer.ff_o_w;
-		model.tensors[base + "output.dense.bias"] = layer.ff_o_b;
-		model.tensors[base + "output.LayerNorm.weight"] = layer.ln_out_w;
-		model.tensors[base + "output.LayerNorm.bias"] = layer.ln_out_b;
-	}
-
-	while (true) {
-		int32_t n_dims, length, ftype_in;
-		fin.read((char *)&n_dims, sizeof(n_dims));
-		if (fin.eof()) {
-			break;
+		layer.q_w = weight(base + "attention.self.query.weight", hparams.n_embd, hparams.n_embd);
+		layer.q_b = weight(base + "attention.self.query.bias", hparams.n_embd, 1);
+		layer.k_w = weight(base + "attention.self.key.weight", hparams.n_embd, hparams.n_embd);
+		layer.k_b = weight(base + "attention.self.key.bias", hparams.n_embd, 1);
+		layer.v_w = weight(base + "attention.self.value.weight", hparams.n_embd, hparams.n_embd);
+		layer.v_b = weight(base + "attention.self.value.bias", hparams.n_embd, 1);
+		layer.o_w = weight(base + "attention.output.dense.weight", hparams.n_embd, hparams.n_embd);
+		layer.o_b = weight(base + "attention.output.dense.bias", hparams.n_embd, 1);
+		layer.ln_att_w = weight(base + "attention.output.LayerNorm.weight", hparams.n_embd, 1);
+		layer.ln_att_b = weight(base + "attention.output.LayerNorm.bias", hparams.n_embd, 1);
+		layer.ff_i_w = weight(base + "intermediate.dense.weight", hparams.n_embd, hparams.n_intermediate);
+		layer.ff_i_b = weight(base + "intermediate.dense.bias", hparams.n_intermediate, 1);
+		layer.ff_o_w = weight(base + "output.dense.weight", hparams.n_intermediate, hparams.n_embd);
+		layer.ff_o_b = weight(base + "output.dense.bias", hparams.n_embd, 1);
+		layer.ln_out_w = weight(base + "output.LayerNorm.weight", hparams.n_embd, 1);
+		layer.ln_out_b = weight(base + "output.LayerNorm.bias", hparams.n_embd, 1);
+	}
+	if (!complete) {
+		return false;
+	}
+	// The fused operations of the graph read biases and LayerNorm parameters as floats
+	std::vector<struct ggml_tensor *> vectors = {model.ln_e_w, model.ln_e_b, model.classifier_bias};
+	for (auto &layer : model.layers) {
+		vectors.insert(vectors.end(), {layer.q_b, layer.k_b, layer.v_b, layer.o_b, layer.ln_att_w, layer.ln_att_b,
+		                               layer.ff_i_b, layer.ff_o_b, layer.ln_out_w, layer.ln_out_b});
+	}
+	for (auto *vector : vectors) {
+		if (!ner_fused_operand(vector)) {
+			return false;
 		}
-		fin.read((char *)&length, sizeof(length));
-		fin.read((char *)&ftype_in, sizeof(ftype_in));
+	}
 
-		int64_t ne[2] = {1, 1};
-		for (int i = 0; i < n_dims; i++) {
-			int32_t ne_cur;
-			fin.read((char *)&ne_cur, sizeof(ne_cur));
-			ne[i] = ne_cur;
-		}
-		std::string name(length, 0);
-		fin.read(&name[0], length);
-
-		auto it = model.tensors.find(name);
-		if (it == model.tensors.end()) {
-			// Skip unknown tensor
-			ggml_type t = (ftype_in == 0) ? GGML_TYPE_F32 : (ftype_in == 1 ? GGML_TYPE_F16 : GGML_TYPE_Q4_0);
-			size_t row_size = (ggml_type_size(t) * ne[0]) / ggml_blck_size(t);
-			fin.seekg(row_size * ne[1], std::ios::cur);
-			continue;
+	// Aligned tensors are used in place; the others (e.g. from unpadded legacy files) are copied
+	size_t copy_size = 0;
+	for (auto &entry : model.tensors) {
+		const uint8_t *src = records[entry.first].data;
+		if ((uintptr_t)src % NER_TENSOR_ALIGN != 0) {
+			copy_size += ner_pad(ggml_nbytes(entry.second), NER_TENSOR_ALIGN);
 		}
-		auto *tensor = it->second;
-		fin.read((char *)tensor->data, ggml_nbytes(tensor));
 	}
-
-	new_ner->buf_compute.resize(128 * 1024 * 1024); // 128MB compute buffer
-	new_ner->mem_per_token = 1024 * 1024;          // Dummy estimate
-	return new_ner;
+	uint8_t *dst = nullptr;
+	if (copy_size > 0) {
+		new_ner->buf_weights.resize(copy_size + NER_TENSOR_ALIGN);
+		dst = (uint8_t *)ner_pad((uintptr_t)new_ner->buf_weights.data, NER_TENSOR_ALIGN);
+	}
+	for (auto &entry : model.tensors) {
+		auto *tensor = entry.second;
+		const uint8_t *src = records[entry.first].data;
+		if ((uintptr_t)src % NER_TENSOR_ALIGN == 0) {
+			tensor->data = (void *)src;
+		} else {
+			memcpy(dst, src, ggml_nbytes(tensor));
+			tensor->data = dst;
+			dst += ner_pad(ggml_nbytes(tensor), NER_TENSOR_ALIGN);
+		}
+	}
+	return ner_prepare_weights(new_ner);
 }
 
 struct ner_ctx *ner_load_from_file(const char *fname) {
-	std::ifstream fin(fname, std::ios::binary);
-	if (!fin) {
+	ner_ctx *new_ner = new ner_ctx;
+	if (!new_ner->mapping.map_file(fname) ||
+	    !ner_load_internal(new_ner, new_ner->mapping.data, new_ner->mapping.size)) {
+		ner_free(new_ner);
 		return nullptr;
 	}
-	return ner_load_internal(fin);
+	return new_ner;
 }
 
 struct ner_ctx *ner_load_from_memory(const uint8_t *data, size_t size) {
-	memory_buffer buf(data, size);
-	std::istream fin(&buf);
-	return ner_load_internal(fin);
+	ner_ctx *new_ner = new ner_ctx;
+	if (!ner_load_internal(new_ner, data, size)) {
+		ner_free(new_ner);
+		return nullptr;
+	}
+	return new_ner;
 }
 
 void ner_free(struct ner_ctx *ctx) {
@@ -312,116 +1314,309 @@ void ner_free(struct ner_ctx *ctx) {
 	}
 }
 
-void ner_eval(struct ner_ctx *ctx, int32_t n_threads, ner_vocab_id *tokens, int32_t n_tokens, float *logits) {
-	const auto &model = ctx->model;
+struct ner_exec *ner_exec_init(struct ner_ctx *ctx) {
+	if (!ctx) {
+		return nullptr;
+	}
+	ner_exec *exec = new ner_exec;
+	exec->ctx = ctx;
+	return exec;
+}
+
+void ner_exec_set_memory_limit(struct ner_exec *exec, size_t limit) {
+	exec->memory_limit = limit;
+}
+
+size_t ner_exec_memory_usage(struct ner_exec *exec) {
+	size_t usage = exec->buf_scratch[NER_SCRATCH_ATT].size + exec->buf_scratch[NER_SCRATCH_FF].size;
+	usage += exec->buf_work.size;
+	for (auto &graph : exec->graphs) {
+		usage += graph->buf_compute.size;
+	}
+	return usage;
+}
+
+void ner_exec_free(struct ner_exec *exec) {
+	delete exec;
+}
+
+int32_t ner_seq_bucket(struct ner_ctx *ctx, int32_t n_tokens) {
+	const int32_t n_max_tokens = ctx->model.hparams.n_max_tokens;
+	for (auto bucket : NER_SEQ_BUCKETS) {
+		if (n_tokens <= bucket) {
+			return std::min(bucket, n_max_tokens);
+		}
+	}
+	return n_max_tokens;
+}
+
+// Upper bound of the memory needed to evaluate n_batch sequences padded to n_seq tokens, following ner_build_graph:
+// every intermediate of a layer is materialized in its scratch region. Attention scores are not (see ner_attention),
+// so nothing grows with the square of n_seq.
+static ner_graph_mem ner_compute_size(const ner_hparams &hparams, int32_t n_seq, int32_t n_batch) {
+	const size_t T = (size_t)n_seq * n_batch;
+	const size_t E = hparams.n_embd;
+	const size_t I = hparams.n_intermediate;
+	// tensor objects, including the parameters of views and custom operations
+	const size_t n_objects = 32 + 48 * hparams.n_layer;
+
+	ner_graph_mem mem;
+	mem.ctx = n_objects * (ggml_tensor_overhead() + 64) + (4 * T + 2 * T * hparams.n_labels) * sizeof(float);
+	mem.scratch[NER_SCRATCH_ATT] = 12 * T * E * sizeof(float);
+	mem.scratch[NER_SCRATCH_FF] = std::max(6 * T * E, 3 * T * E + 2 * T * I) * sizeof(float);
+	return mem;
+}
+
+// Builds the graph of n_batch sequences padded to n_seq tokens, with a context of ctx_size bytes and the given
+// scratch regions. Nothing is written to the scratch regions until the graph is computed.
+static ner_graph *ner_build_graph(const ner_model &model, int32_t n_seq, int32_t n_batch, size_t ctx_size,
+                                  ner_buffer *scratch) {
 	const auto &hparams = model.hparams;
 
 	const int n_embd = hparams.n_embd;
 	const int n_layer = hparams.n_layer;
 	const int n_head = hparams.n_head;
-	const int d_head = n_embd / n_head;
-	const int N = n_tokens;
+	const int N = n_seq;
+	const int B = n_batch;
+	const int T = N * B;
+
+	auto *graph = new ner_graph;
+	graph->n_seq = n_seq;
+	graph->n_batch = n_batch;
+	graph->buf_compute.resize(ctx_size);
 
 	struct ggml_init_params params = {
-	    .mem_size = ctx->buf_compute.size, .mem_buffer = ctx->buf_compute.data, .no_alloc = false};
+	    .mem_size = graph->buf_compute.size, .mem_buffer = graph->buf_compute.data, .no_alloc = false};
 	struct ggml_context *ctx0 = ggml_init(params);
-	struct ggml_cgraph gf = {};
+	graph->ctx = ctx0;
 
-	struct ggml_tensor *token_layer = ggml_new_tensor_1d(ctx0, GGML_TYPE_I32, N);
-	memcpy(token_layer->data, tokens, N * sizeof(int32_t));
+	// Switches tensor allocation to scratch region i (or to ctx0 if i < 0), recording how much of the region
+	// that was active has been used
+	int scratch_active = -1;
+	auto use_scratch = [&](int i) {
+		struct ggml_scratch region = {0, 0, nullptr};
+		if (i >= 0) {
+			region.size = scratch[i].size;
+			region.data = scratch[i].data;
+		}
+		size_t used = ggml_set_scratch(ctx0, region);
+		if (scratch_active >= 0) {
+			graph->mem.scratch[scratch_active] = std::max(graph->mem.scratch[scratch_active], used);
+		}
+		scratch_active = i;
+	};
 
-	struct ggml_tensor *token_types = ggml_new_tensor_1d(ctx0, GGML_TYPE_I32, N);
-	ggml_set_zero(token_types);
+	struct ggml_tensor *token_layer = ggml_new_tensor_1d(ctx0, GGML_TYPE_I32, T);
+	graph->tokens = token_layer;
 
-	struct ggml_tensor *positions = ggml_new_tensor_1d(ctx0, GGML_TYPE_I32, N);
-	for (int i = 0; i < N; i++) {
-		ggml_set_i32_1d(positions, i, i);
-	}
+	// [N, 1, 1, B]: 0 for real keys, -inf for padding
+	struct ggml_tensor *mask = ggml_new_tensor_4d(ctx0, GGML_TYPE_F32, N, 1, 1, B);
+	graph->mask = mask;
 
+	use_scratch(NER_SCRATCH_FF);
 	struct ggml_tensor *inpL = ggml_get_rows(ctx0, model.word_embeddings, token_layer);
-	inpL = ggml_add(ctx0, ggml_get_rows(ctx0, model.token_type_embeddings, token_types), inpL);
-	inpL = ggml_add(ctx0, ggml_get_rows(ctx0, model.position_embeddings, positions), inpL);
+	// the position (and token type) embeddings of the first N positions, broadcast over the sequences
+	inpL = ner_add_bcast(ctx0, inpL,
+	                     ggml_view_2d(ctx0, model.pos_type_embeddings, n_embd, N,
+	                                  model.pos_type_embeddings->nb[1], 0));
 
 	// embd norm
-	{
-		inpL = ggml_norm(ctx0, inpL);
-		inpL = ggml_add(ctx0, ggml_mul(ctx0, ggml_repeat(ctx0, model.ln_e_w, inpL), inpL),
-		                ggml_repeat(ctx0, model.ln_e_b, inpL));
-	}
+	inpL = ner_norm_affine(ctx0, inpL, model.ln_e_w, model.ln_e_b);
+
+	graph->attention.mask = mask;
+	graph->attention.n_head = n_head;
+	// 1/sqrt(d_head) is folded into the query weights, see ner_prepare_weights
+	graph->attention.scale = 1.0f;
 
 	// layers
 	for (int il = 0; il < n_layer; il++) {
 		struct ggml_tensor *cur = inpL;
 
-		// self-attention
+		use_scratch(NER_SCRATCH_ATT);
+
+		// self-attention of all heads and sequences, straight from the [n_embd, T] projections
 		{
-			struct ggml_tensor *Qcur = ggml_add(ctx0, ggml_repeat(ctx0, model.layers[il].q_b, cur),
-			                                    ggml_mul_mat(ctx0, model.layers[il].q_w, cur));
-			struct ggml_tensor *Q = ggml_permute(ctx0, ggml_reshape_3d(ctx0, Qcur, d_head, n_head, N), 0, 2, 1, 3);
+			const auto &layer = model.layers[il];
+			struct ggml_tensor *Qcur, *Kcur, *Vcur;
+			if (layer.qkv_w) {
+				// rows of [3 * n_embd, T]: the query, key and value of a token side by side
+				struct ggml_tensor *QKV = ner_add_bcast(ctx0, ggml_mul_mat(ctx0, layer.qkv_w, cur), layer.qkv_b);
+				Qcur = ggml_view_2d(ctx0, QKV, n_embd, T, QKV->nb[1], 0);
+				Kcur = ggml_view_2d(ctx0, QKV, n_embd, T, QKV->nb[1], n_embd * sizeof(float));
+				Vcur = ggml_view_2d(ctx0, QKV, n_embd, T, QKV->nb[1], 2 * n_embd * sizeof(float));
+			} else {
+				Qcur = ner_add_bcast(ctx0, ggml_mul_mat(ctx0, layer.q_w, cur), layer.q_b);
+				Kcur = ner_add_bcast(ctx0, ggml_mul_mat(ctx0, layer.k_w, cur), layer.k_b);
+				Vcur = ner_add_bcast(ctx0, ggml_mul_mat(ctx0, layer.v_w, cur), layer.v_b);
+			}
+			cur = ner_attention(ctx0, Qcur, Kcur, Vcur, &graph->attention);
+		}
+
+		// attention output + residual, then attention norm
+		cur = ner_add_residual(ctx0, ggml_mul_mat(ctx0, model.layers[il].o_w, cur), model.layers[il].o_b, inpL);
+		cur = ner_norm_affine(ctx0, cur, model.layers[il].ln_att_w, model.layers[il].ln_att_b);
+
+		struct ggml_tensor *att_output = cur;
+
+		use_scratch(NER_SCRATCH_FF);
 
-			struct ggml_tensor *Kcur = ggml_add(ctx0, ggml_repeat(ctx0, model.layers[il].k_b, cur),
-			                                    ggml_mul_mat(ctx0, model.layers[il].k_w, cur));
-			struct ggml_tensor *K = ggml_permute(ctx0, ggml_reshape_3d(ctx0, Kcur, d_head, n_head, N), 0, 2, 1, 3);
+		// intermediate
+		cur = ner_add_gelu(ctx0, ggml_mul_mat(ctx0, model.layers[il].ff_i_w, cur), model.layers[il].ff_i_b);
+
+		// output + residual, then output norm
+		cur = ner_add_residual(ctx0, ggml_mul_mat(ctx0, model.layers[il].ff_o_w, cur), model.layers[il].ff_o_b,
+		                       att_output);
+		cur = ner_norm_affine(ctx0, cur, model.layers[il].ln_out_w, model.layers[il].ln_out_b);
+
+		inpL = cur;
+	}
 
-			struct ggml_tensor *Vcur = ggml_add(ctx0, ggml_repeat(ctx0, model.layers[il].v_b, cur),
-			                                    ggml_mul_mat(ctx0, model.layers[il].v_w, cur));
-			struct ggml_tensor *V = ggml_permute(ctx0, ggml_reshape_3d(ctx0, Vcur, d_head, n_head, N), 0, 2, 1, 3);
+	use_scratch(-1);
 
-			struct ggml_tensor *KQ = ggml_mul_mat(ctx0, K, Q);
-			KQ = ggml_soft_max(ctx0, ggml_scale(ctx0, KQ, ggml_new_f32(ctx0, 1.0f / sqrt((float)d_head))));
+	// Classifier head: logits = inpL * classifier_weight + classifier_bias
+	// inpL is [n_embd, T], weight is [n_embd, n_labels]
+	// res will be [n_labels, T]
+	struct ggml_tensor *res = ggml_mul_mat(ctx0, model.classifier_weight, inpL);
+	res = ner_add_bcast(ctx0, res, model.classifier_bias);
+	graph->logits = res;
 
-			V = ggml_cont(ctx0, ggml_transpose(ctx0, V));
-			struct ggml_tensor *KQV = ggml_mul_mat(ctx0, V, KQ);
-			KQV = ggml_permute(ctx0, KQV, 0, 2, 1, 3);
+	ggml_build_forward_expand(&graph->gf, res);
+	graph->mem.ctx = ggml_used_mem(ctx0);
+	return graph;
+}
 
-			cur = ggml_cpy(ctx0, KQV, ggml_new_tensor_2d(ctx0, GGML_TYPE_F32, n_embd, N));
+// Returns the cached graph for (n_seq, n_batch), building it and evicting the least recently used ones if needed
+static ner_graph *ner_exec_graph(struct ner_exec *exec, int32_t n_seq, int32_t n_batch) {
+	auto &graphs = exec->graphs;
+	for (auto &graph : graphs) {
+		if (graph->n_seq == n_seq && graph->n_batch == n_batch) {
+			return graph.get();
 		}
+	}
 
-		// attention output
-		cur =
-		    ggml_add(ctx0, ggml_repeat(ctx0, model.layers[il].o_b, cur), ggml_mul_mat(ctx0, model.layers[il].o_w, cur));
-		cur = ggml_add(ctx0, cur, inpL);
+	// Measure the graph first, building it over the upper bound of ner_compute_size: the scratch regions are not
+	// written to while building, so their pages are never committed
+	const uint64_t start_ns = ner_time_ns();
+	const auto &model = exec->ctx->model;
+	ner_graph_mem need;
+	{
+		auto bound = ner_compute_size(model.hparams, n_seq, n_batch);
+		ner_buffer scratch[NER_SCRATCH_COUNT];
+		for (int i = 0; i < NER_SCRATCH_COUNT; i++) {
+			scratch[i].resize(bound.scratch[i]);
+		}
+		std::unique_ptr<ner_graph> measure(ner_build_graph(model, n_seq, n_batch, bound.ctx, scratch));
+		need = measure->mem;
+	}
 
-		// attention norm
-		{
-			cur = ggml_norm(ctx0, cur);
-			cur = ggml_add(ctx0, ggml_mul(ctx0, ggml_repeat(ctx0, model.layers[il].ln_att_w, cur), cur),
-			               ggml_repeat(ctx0, model.layers[il].ln_att_b, cur));
+	// then allocate exactly what it needs; growing the shared scratch regions invalidates every cached graph
+	for (int i = 0; i < NER_SCRATCH_COUNT; i++) {
+		if (need.scratch[i] > exec->buf_scratch[i].size) {
+			graphs.clear();
+			exec->buf_scratch[i].resize(need.scratch[i]);
 		}
+	}
+	auto lru = [](const std::unique_ptr<ner_graph> &a, const std::unique_ptr<ner_graph> &b) {
+		return a->last_used < b->last_used;
+	};
+	while (!graphs.empty() && (graphs.size() >= NER_MAX_GRAPHS ||
+	                           (exec->memory_limit && ner_exec_memory_usage(exec) + need.ctx > exec->memory_limit))) {
+		graphs.erase(std::min_element(graphs.begin(), graphs.end(), lru));
+	}
+	graphs.emplace_back(ner_build_graph(model, n_seq, n_batch, need.ctx, exec->buf_scratch));
+	ner_stat_add(NER_STAT(n_graph_builds), 1);
+	ner_stat_add(NER_STAT(graph_build_ns), ner_time_ns() - start_ns);
+	return graphs.back().get();
+}
 
-		struct ggml_tensor *att_output = cur;
+// Batch size of the graph evaluating n_batch sequences padded to n_seq tokens: n_batch rounded up to m * 2^k with
+// m <= 8, less than a quarter more, so that the last batches of chunks share a few graph shapes. A smaller cached
+// graph for n_seq that holds them is used instead if there is one.
+static int32_t ner_exec_batch_size(const struct ner_exec *exec, int32_t n_seq, int32_t n_batch) {
+	int32_t step = 1;
+	while (n_batch > 8 * step) {
+		step *= 2;
+	}
+	int32_t n_best = (n_batch + step - 1) / step * step;
+	for (auto &graph : exec->graphs) {
+		if (graph->n_seq == n_seq && graph->n_batch >= n_batch && graph->n_batch < n_best) {
+			n_best = graph->n_batch;
+		}
+	}
+	return n_best;
+}
 
-		// intermediate
-		cur = ggml_mul_mat(ctx0, model.layers[il].ff_i_w, cur);
-		cur = ggml_add(ctx0, ggml_repeat(ctx0, model.layers[il].ff_i_b, cur), cur);
-		cur = ggml_gelu(ctx0, cur);
+void ner_eval_batch(struct ner_exec *exec, int32_t n_threads, const ner_vocab_id *tokens, const int32_t *n_tokens,
+                    int32_t n_batch, int32_t n_stride, float *logits) {
+	const int n_labels = exec->ctx->model.hparams.n_labels;
 
-		// output
-		cur = ggml_mul_mat(ctx0, model.layers[il].ff_o_w, cur);
-		cur = ggml_add(ctx0, ggml_repeat(ctx0, model.layers[il].ff_o_b, cur), cur);
-		cur = ggml_add(ctx0, att_output, cur);
+	// Sequences are padded to a length bucket, and batches to one of a few sizes, so that graphs can be reused. Full
+	// batches of a bucket always have the same size: only the last one of a chunk is padded.
+	int32_t n_seq = 1;
+	for (int b = 0; b < n_batch; b++) {
+		n_seq = std::max(n_seq, n_tokens[b]);
+	}
+	n_seq = ner_seq_bucket(exec->ctx, n_seq);
+	const int32_t n_batch_padded = ner_exec_batch_size(exec, n_seq, n_batch);
 
-		// output norm
-		{
-			cur = ggml_norm(ctx0, cur);
-			cur = ggml_add(ctx0, ggml_mul(ctx0, ggml_repeat(ctx0, model.layers[il].ln_out_w, cur), cur),
-			               ggml_repeat(ctx0, model.layers[il].ln_out_b, cur));
+	// Split batches whose compute buffers would not fit in the memory limit. Single sequences are always evaluated.
+	if (exec->memory_limit && n_batch > 1 &&
+	    ner_compute_size(exec->ctx->model.hparams, n_seq, n_batch_padded).total() > exec->memory_limit) {
+		int32_t n_split = (n_batch + 1) / 2;
+		while (n_split > 1 &&
+		       ner_compute_size(exec->ctx->model.hparams, n_seq, n_split).total() > exec->memory_limit) {
+			n_split = (n_split + 1) / 2;
+		}
+		for (int32_t b = 0; b < n_batch; b += n_split) {
+			ner_eval_batch(exec, n_threads, tokens + (size_t)b * n_stride, n_tokens + b,
+			               std::min(n_split, n_batch - b), n_stride, logits + (size_t)b * n_stride * n_labels);
 		}
+		return;
+	}
 
-		inpL = cur;
+	ner_graph *graph = ner_exec_graph(exec, n_seq, n_batch_padded);
+	graph->last_used = ++exec->n_evals;
+
+	const int N = n_seq;
+	for (int b = 0; b < n_batch_padded; b++) {
+		auto *seq_tokens = (int32_t *)graph->tokens->data + b * N;
+		auto *seq_mask = (float *)graph->mask->data + b * N;
+		// padding sequences hold a single [PAD] token, so that their softmax stays finite
+		const int32_t n = b < n_batch ? n_tokens[b] : 1;
+		for (int i = 0; i < N; i++) {
+			seq_tokens[i] = (b < n_batch && i < n) ? tokens[b * n_stride + i] : 0;
+			seq_mask[i] = i < n ? 0.0f : -INFINITY;
+		}
 	}
 
-	// Classifier head: logits = inpL * classifier_weight + classifier_bias
-	// inpL is [n_embd, N], weight is [n_embd, n_labels]
-	// res will be [n_labels, N]
-	struct ggml_tensor *res = ggml_add(ctx0, ggml_mul_mat(ctx0, model.classifier_weight, inpL),
-	                                   ggml_repeat(ctx0, model.classifier_bias, inpL));
+	// ggml starts its workers on every compute: only pay for them when each gets a reasonable share of the tokens
+	n_threads = std::max(1, std::min(n_threads, N * n_batch_padded / NER_MIN_TOKENS_PER_THREAD));
+	struct ggml_cplan plan = ggml_graph_plan(&graph->gf, n_threads);
+	if (plan.work_size > exec->buf_work.size) {
+		exec->buf_work.resize(plan.work_size);
+	}
+	plan.work_data = exec->buf_work.data;
+	ner_stat_max(NER_STAT(arena_high_water), ner_exec_memory_usage(exec));
 
-	ggml_build_forward_expand(&gf, res);
-	ggml_graph_compute_with_ctx(ctx0, &gf, n_threads);
+	const uint64_t start_ns = ner_time_ns();
+	ggml_graph_compute(&graph->gf, &plan);
+	const uint64_t compute_ns = ner_time_ns() - start_ns;
+	ner_stat_add(NER_STAT(n_computes), 1);
+	ner_stat_add(NER_STAT(n_sequences), n_batch);
+	ner_stat_add(NER_STAT(n_padded_tokens), (uint64_t)N * n_batch_padded);
+	ner_stat_add(NER_STAT(compute_ns), compute_ns);
+	ner_stat_hist(NER_STAT(compute_us_hist), compute_ns / 1000);
+	ner_stat_hist(NER_STAT(batch_tokens_hist), (uint64_t)N * n_batch_padded);
 
-	memcpy(logits, ggml_get_data(res), N * hparams.n_labels * sizeof(float));
-	ggml_free(ctx0);
+	const float *res_data = (const float *)ggml_get_data(graph->logits);
+	for (int b = 0; b < n_batch; b++) {
+		memcpy(logits + (size_t)b * n_stride * n_labels, res_data + (size_t)b * N * n_labels,
+		       n_tokens[b] * n_labels * sizeof(float));
+	}
+}
+
+void ner_eval(struct ner_exec *exec, int32_t n_threads, ner_vocab_id *tokens, int32_t n_tokens, float *logits) {
+	ner_eval_batch(exec, n_threads, tokens, &n_tokens, 1, n_tokens, logits);
 }
 
 int32_t ner_n_embd(struct ner_ctx *ctx) {
@@ -433,14 +1628,18 @@ int32_t ner_n_max_tokens(struct ner_ctx *ctx) {
 int32_t ner_n_labels(struct ner_ctx *ctx) {
 	return ctx->model.hparams.n_labels;
 }
-const char *ner_vocab_id_to_token(struct ner_ctx *ctx, ner_vocab_id id) {
-	auto it = ctx->vocab._id_to_token.find(id);
-	if (it != ctx->vocab._id_to_token.end()) {
-		return it->second.c_str();
+int32_t ner_n_label_types(struct ner_ctx *ctx) {
+	return (int32_t)ctx->labels.types.size();
+}
+const char *ner_label_type(struct ner_ctx *ctx, int32_t type) {
+	if (type < 0 || type >= (int32_t)ctx->labels.types.size()) {
+		return "O";
 	}
-	it = ctx->vocab._id_to_subword_token.find(id);
-	if (it != ctx->vocab._id_to_subword_token.end()) {
-		return it->second.c_str();
+	return ctx->labels.types[type].c_str();
+}
+const char *ner_vocab_id_to_token(struct ner_ctx *ctx, ner_vocab_id id) {
+	if (id < 0 || id >= ctx->vocab.n_vocab) {
+		return "[UNK]";
 	}
-	return "[UNK]";
+	return ctx->vocab.token(id);
 }
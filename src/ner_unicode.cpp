@@ -0,0 +1,237 @@
+#include "ner_unicode.hpp"
+#include "ner_unicode_tables.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+#define W NER_CHAR_WORD
+#define S NER_CHAR_SPACE
+#define P NER_CHAR_PUNCT
+#define R NER_CHAR_REMOVED
+
+// Tab, line feed and carriage return separate words, other control characters are removed. Every printable
+// non-alphanumeric character is punctuation, as in BERT.
+const uint8_t NER_ASCII_CLASS[128] = {
+    R, R, R, R, R, R, R, R, R, S, S, R, R, S, R, R, // 0x00
+    R, R, R, R, R, R, R, R, R, R, R, R, R, R, R, R, // 0x10
+    S, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, // 0x20
+    W, W, W, W, W, W, W, W, W, W, P, P, P, P, P, P, // 0x30
+    P, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, // 0x40
+    W, W, W, W, W, W, W, W, W, W, W, P, P, P, P, P, // 0x50
+    P, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, // 0x60
+    W, W, W, W, W, W, W, W, W, W, W, P, P, P, P, R, // 0x70
+};
+
+#undef W
+#undef S
+#undef P
+#undef R
+
+// Code points BERT treats as CJK ideographs (the CJK Unified Ideographs blocks and the compatibility ideographs)
+static const ner_unicode_range NER_UNICODE_CJK[] = {
+    {0x3400, 0x4DBF},   {0x4E00, 0x9FFF},   {0xF900, 0xFAFF},   {0x20000, 0x2A6DF},
+    {0x2A700, 0x2B73F}, {0x2B740, 0x2B81F}, {0x2B820, 0x2CEAF}, {0x2F800, 0x2FA1F},
+};
+
+// Whitespace outside ASCII: the space separators (Zs), and the line and paragraph separators
+static const uint32_t NER_UNICODE_SPACES[] = {0x00A0, 0x1680, 0x2000, 0x2001, 0x2002, 0x2003, 0x2004, 0x2005, 0x2006,
+                                              0x2007, 0x2008, 0x2009, 0x200A, 0x2028, 0x2029, 0x202F, 0x205F, 0x3000};
+
+// Hangul syllables, decomposed arithmetically into their jamo by NFD
+static const uint32_t NER_HANGUL_S_BASE = 0xAC00;
+static const uint32_t NER_HANGUL_L_BASE = 0x1100;
+static const uint32_t NER_HANGUL_V_BASE = 0x1161;
+static const uint32_t NER_HANGUL_T_BASE = 0x11A7;
+static const uint32_t NER_HANGUL_V_COUNT = 21;
+static const uint32_t NER_HANGUL_T_COUNT = 28;
+static const uint32_t NER_HANGUL_S_COUNT = 19 * NER_HANGUL_V_COUNT * NER_HANGUL_T_COUNT;
+
+template <size_t N>
+static bool ner_in_ranges(const ner_unicode_range (&ranges)[N], uint32_t cp) {
+	auto it = std::upper_bound(ranges, ranges + N, cp,
+	                           [](uint32_t value, const ner_unicode_range &range) { return value < range.first; });
+	return it != ranges && cp <= (it - 1)->last;
+}
+
+template <class T, size_t N>
+static const T *ner_find_code_point(const T (&table)[N], uint32_t cp) {
+	auto it = std::lower_bound(table, table + N, cp, [](const T &entry, uint32_t value) { return entry.cp < value; });
+	return it != table + N && it->cp == cp ? it : nullptr;
+}
+
+size_t ner_utf8_decode(const char *p, const char *end, uint32_t *cp) {
+	const auto *s = (const uint8_t *)p;
+	if (s[0] < 0x80) {
+		*cp = s[0];
+		return 1;
+	}
+	size_t len;
+	uint32_t min;
+	if ((s[0] & 0xE0) == 0xC0) {
+		len = 2, min = 0x80, *cp = s[0] & 0x1F;
+	} else if ((s[0] & 0xF0) == 0xE0) {
+		len = 3, min = 0x800, *cp = s[0] & 0x0F;
+	} else if ((s[0] & 0xF8) == 0xF0) {
+		len = 4, min = 0x10000, *cp = s[0] & 0x07;
+	} else {
+		return 0;
+	}
+	if ((size_t)(end - p) < len) {
+		return 0;
+	}
+	for (size_t i = 1; i < len; i++) {
+		if ((s[i] & 0xC0) != 0x80) {
+			return 0;
+		}
+		*cp = (*cp << 6) | (s[i] & 0x3F);
+	}
+	if (*cp < min || *cp > 0x10FFFF || (*cp >= 0xD800 && *cp <= 0xDFFF)) {
+		return 0;
+	}
+	return len;
+}
+
+size_t ner_utf8_encode(uint32_t cp, char *out) {
+	if (cp < 0x80) {
+		out[0] = (char)cp;
+		return 1;
+	}
+	if (cp < 0x800) {
+		out[0] = (char)(0xC0 | (cp >> 6));
+		out[1] = (char)(0x80 | (cp & 0x3F));
+		return 2;
+	}
+	if (cp < 0x10000) {
+		out[0] = (char)(0xE0 | (cp >> 12));
+		out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+		out[2] = (char)(0x80 | (cp & 0x3F));
+		return 3;
+	}
+	out[0] = (char)(0xF0 | (cp >> 18));
+	out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+	out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+	out[3] = (char)(0x80 | (cp & 0x3F));
+	return 4;
+}
+
+ner_char_class ner_char_classify(uint32_t cp) {
+	if (cp < 0x80) {
+		return (ner_char_class)NER_ASCII_CLASS[cp];
+	}
+	if (std::binary_search(std::begin(NER_UNICODE_SPACES), std::end(NER_UNICODE_SPACES), cp)) {
+		return NER_CHAR_SPACE;
+	}
+	if (ner_in_ranges(NER_UNICODE_CJK, cp)) {
+		return NER_CHAR_CJK;
+	}
+	if (ner_in_ranges(NER_UNICODE_REMOVED, cp)) {
+		return NER_CHAR_REMOVED;
+	}
+	if (ner_in_ranges(NER_UNICODE_PUNCTUATION, cp)) {
+		return NER_CHAR_PUNCT;
+	}
+	return NER_CHAR_WORD;
+}
+
+bool ner_char_is_lower(uint32_t cp) {
+	if (cp < 0x80) {
+		return (cp >= 'a' && cp <= 'z') || (cp >= '0' && cp <= '9');
+	}
+	return ner_in_ranges(NER_UNICODE_LOWERCASE, cp) || ner_in_ranges(NER_UNICODE_MARKS, cp);
+}
+
+size_t ner_char_fold(uint32_t cp, uint32_t *out) {
+	if (cp < 0x80) {
+		out[0] = cp >= 'A' && cp <= 'Z' ? cp + ('a' - 'A') : cp;
+		return 1;
+	}
+	if (cp - NER_HANGUL_S_BASE < NER_HANGUL_S_COUNT) {
+		const uint32_t index = cp - NER_HANGUL_S_BASE;
+		const uint32_t n_vt = NER_HANGUL_V_COUNT * NER_HANGUL_T_COUNT;
+		out[0] = NER_HANGUL_L_BASE + index / n_vt;
+		out[1] = NER_HANGUL_V_BASE + index % n_vt / NER_HANGUL_T_COUNT;
+		out[2] = NER_HANGUL_T_BASE + index % NER_HANGUL_T_COUNT;
+		return index % NER_HANGUL_T_COUNT ? 3 : 2;
+	}
+	if (ner_in_ranges(NER_UNICODE_MARKS, cp)) {
+		return 0;
+	}
+	if (auto *fold = ner_find_code_point(NER_UNICODE_FOLDS, cp)) {
+		out[0] = fold->to;
+		return 1;
+	}
+	if (auto *fold = ner_find_code_point(NER_UNICODE_FOLDS_MULTI, cp)) {
+		size_t n = 0;
+		for (; n < 3 && fold->to[n]; n++) {
+			out[n] = fold->to[n];
+		}
+		return n;
+	}
+	out[0] = cp;
+	return 1;
+}
+
+// Blocks of 16 bytes are tested at once: a byte is in [lo, lo + n) if byte - lo < n, unsigned. The first block
+// holding another byte is finished byte by byte.
+const char *ner_scan_word(const char *p, const char *end, bool lowercase) {
+#if defined(__SSE2__)
+	// SSE2 only compares signed bytes: x < n unsigned is (x ^ 0x80) < (n ^ 0x80) signed
+	const __m128i bias = _mm_set1_epi8((char)0x80);
+	const __m128i digit_n = _mm_set1_epi8((char)(10 ^ 0x80));
+	const __m128i alpha_n = _mm_set1_epi8((char)(26 ^ 0x80));
+	const __m128i upper_on = lowercase ? _mm_setzero_si128() : _mm_set1_epi8((char)0xFF);
+	for (; end - p >= 16; p += 16) {
+		const __m128i v = _mm_loadu_si128((const __m128i *)p);
+		const __m128i digit = _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(v, _mm_set1_epi8('0')), bias), digit_n);
+		const __m128i lower = _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(v, _mm_set1_epi8('a')), bias), alpha_n);
+		const __m128i upper = _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(v, _mm_set1_epi8('A')), bias), alpha_n);
+		const __m128i word = _mm_or_si128(_mm_or_si128(digit, lower), _mm_and_si128(upper, upper_on));
+		if (_mm_movemask_epi8(word) != 0xFFFF) {
+			break;
+		}
+	}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	const uint8x16_t digit_n = vdupq_n_u8(10);
+	const uint8x16_t alpha_n = vdupq_n_u8(26);
+	const uint8x16_t upper_on = vdupq_n_u8(lowercase ? 0 : 0xFF);
+	for (; end - p >= 16; p += 16) {
+		const uint8x16_t v = vld1q_u8((const uint8_t *)p);
+		const uint8x16_t digit = vcltq_u8(vsubq_u8(v, vdupq_n_u8('0')), digit_n);
+		const uint8x16_t lower = vcltq_u8(vsubq_u8(v, vdupq_n_u8('a')), alpha_n);
+		const uint8x16_t upper = vcltq_u8(vsubq_u8(v, vdupq_n_u8('A')), alpha_n);
+		const uint8x16_t word = vorrq_u8(vorrq_u8(digit, lower), vandq_u8(upper, upper_on));
+		if (vminvq_u8(word) != 0xFF) {
+			break;
+		}
+	}
+#elif defined(__wasm_simd128__)
+	const v128_t digit_n = wasm_u8x16_splat(10);
+	const v128_t alpha_n = wasm_u8x16_splat(26);
+	const v128_t upper_on = wasm_u8x16_splat(lowercase ? 0 : 0xFF);
+	for (; end - p >= 16; p += 16) {
+		const v128_t v = wasm_v128_load(p);
+		const v128_t digit = wasm_u8x16_lt(wasm_i8x16_sub(v, wasm_u8x16_splat('0')), digit_n);
+		const v128_t lower = wasm_u8x16_lt(wasm_i8x16_sub(v, wasm_u8x16_splat('a')), alpha_n);
+		const v128_t upper = wasm_u8x16_lt(wasm_i8x16_sub(v, wasm_u8x16_splat('A')), alpha_n);
+		const v128_t word = wasm_v128_or(wasm_v128_or(digit, lower), wasm_v128_and(upper, upper_on));
+		if (!wasm_i8x16_all_true(word)) {
+			break;
+		}
+	}
+#endif
+	for (; p < end; p++) {
+		const uint8_t c = (uint8_t)*p;
+		if ((uint8_t)(c - '0') >= 10 && (uint8_t)(c - 'a') >= 26 && (lowercase || (uint8_t)(c - 'A') >= 26)) {
+			break;
+		}
+	}
+	return p;
+}